@@ -0,0 +1,66 @@
+/* File: arena.cc
+ * --------------
+ * Implementation of the Arena class.
+ */
+
+#include "arena.h"
+#include "compilation.h"
+#include "utility.h"
+#include <stdlib.h>
+
+
+Arena::Arena()
+  : next(NULL), limit(NULL), numAllocations(0), numBytes(0) {}
+
+Arena::~Arena() {
+    for (int i = releases.size() - 1; i >= 0; i--)
+        releases[i].first(releases[i].second);
+    for (int i = 0; i < blocks.size(); i++)
+        free(blocks[i]);
+}
+
+/* Function: Allocate()
+ * --------------------
+ * Requests too big to share a block sensibly (over a quarter of one)
+ * get a block to themselves, so they don't throw away the rest of the
+ * current block.
+ */
+void *Arena::Allocate(size_t size) {
+    size = (size + Alignment - 1) & ~(Alignment - 1);
+    numAllocations++;
+    numBytes += size;
+    if (size <= limit - next) {
+        void *result = next;
+        next += size;
+        return result;
+    }
+
+    size_t blockSize = (size > BlockSize / 4 ? size : BlockSize);
+    char *block = (char *)malloc(blockSize);
+    if (block == NULL) Failure("Out of memory in arena");
+    blocks.push_back(block);
+    if (blockSize == size)
+        return block;   // the current block stays in use
+    next = block + size;
+    limit = block + blockSize;
+    return block;
+}
+
+void Arena::OnRelease(void (*destroy)(void *), void *object) {
+    releases.push_back(std::make_pair(destroy, object));
+}
+
+Arena *Arena::Current() {
+    Compilation *c = Compilation::Current();
+    return (c ? &c->arena : NULL);
+}
+
+
+void *ArenaAllocate(size_t size, void (*destroy)(void *)) {
+    Arena *arena = Arena::Current();
+    if (arena == NULL)
+        return ::operator new(size);
+    void *p = arena->Allocate(size);
+    if (destroy) arena->OnRelease(destroy, p);
+    return p;
+}
@@ -0,0 +1,68 @@
+/* File: arena.h
+ * -------------
+ * An Arena hands out memory by bumping a pointer through large blocks,
+ * and gives all of it back at once when the arena is destroyed. Each
+ * Compilation has one, and the nodes, lists and symbol tables of its
+ * tree are all allocated from it: making a node costs
+ * a pointer bump rather than a trip through malloc, and a long-running
+ * process that compiles file after file gets everything back when each
+ * Compilation goes away.
+ *
+ * Nothing in an arena is freed on its own. Objects whose destructors
+ * matter (those holding STL containers) register themselves to be
+ * destroyed when the arena is released, in the reverse of the order
+ * they were made.
+ *
+ * Node, List and Hashtable allocate from the current arena through their
+ * own operator new, so the usual "new VarDecl(...)" needs no change.
+ */
+
+#ifndef _H_arena
+#define _H_arena
+
+#include <stddef.h>
+#include <vector>
+
+class Arena
+{
+  public:
+    Arena();
+    ~Arena();
+
+            // Returns size bytes aligned for any of the types kept in
+            // arenas (pointers, ints and doubles).
+    void *Allocate(size_t size);
+
+            // Has destroy(object) called when the arena is released.
+    void OnRelease(void (*destroy)(void *), void *object);
+
+    int NumAllocations() const { return numAllocations; }
+    size_t NumBytes() const    { return numBytes; }
+    int NumBlocks() const      { return blocks.size(); }
+
+            // Returns the arena of the calling thread's current
+            // compilation, or NULL if there is none.
+    static Arena *Current();
+
+  private:
+    static const size_t BlockSize = 64 * 1024;
+    static const size_t Alignment = 8;
+
+    char *next, *limit;             // free part of the current block
+    std::vector<char *> blocks;
+    std::vector<std::pair<void (*)(void *), void *> > releases;
+    int numAllocations;
+    size_t numBytes;
+};
+
+
+/* Function: ArenaAllocate()
+ * -------------------------
+ * Returns size bytes from the current arena, or from the heap if there
+ * is no current compilation (as for the types made during static
+ * initialization, which live for the whole run). In the arena, destroy
+ * (if not NULL) is called on the object when the arena is released.
+ */
+void *ArenaAllocate(size_t size, void (*destroy)(void *) = NULL);
+
+#endif
@@ -7,39 +7,135 @@
 #include "ast_decl.h"
 #include "ast_stmt.h"
 #include "errors.h"
-#include <string.h> // strdup
+#include "intern.h"
+#include "symtab.h"
+#include <string.h>
 #include <stdio.h>  // printf
 
-Node::Node(yyltype loc) {
-    location = new yyltype(loc);
+Node::Node(NodeKind k, yyltype loc) {
+    kind = k;
+    location = loc;
     parent = NULL;
+    scope = NULL;
 }
 
-Node::Node() {
-    location = NULL;
+Node::Node(NodeKind k) {
+    kind = k;
+    location.first = location.last = 0;
     parent = NULL;
+    scope = NULL;
 }
 	 
-Identifier::Identifier(yyltype loc, const char *n) : Node(loc) {
-    name = strdup(n);
+Identifier::Identifier(yyltype loc, const char *n) : Node(IdentifierKind, loc) {
+    name = Intern(n);
+    decl = NULL;
 } 
 
+void CheckTree(Node *root) {
+    struct Pending { Node *node; bool childrenDone; bool scopeOpen; };
+    std::vector<Pending> stack;
+    std::vector<Node*> children;
+    SymbolTable symbols;
+    SymbolTable *outer = SymbolTable::Current();
+    SymbolTable::SetCurrent(&symbols);
+
+    stack.push_back((Pending){root, false, false});
+    while (!stack.empty()) {
+        Pending &top = stack.back();
+        Node *node = top.node;
+        if (top.childrenDone) {
+            bool scopeOpen = top.scopeOpen;
+            stack.pop_back();
+            node->checkStmt();
+            if (scopeOpen)
+                symbols.CloseScope();
+            continue;
+        }
+        top.childrenDone = true;
+        children.clear();
+        node->getCheckChildren(children);
+        top.scopeOpen = !children.empty() && node->openScope(&symbols);
+        for (int i = children.size() - 1; i >= 0; i--)
+            stack.push_back((Pending){children[i], false, false});
+    }
+    SymbolTable::SetCurrent(outer);
+}
+
+/* Function: BuildScopes()
+ * ------------------------
+ * Walks the tree top down, keeping with each node waiting on the stack
+ * the Scope its children get. That is the node's own Scope unless the
+ * node is a loop, function or class, when it is a new record for
+ * inside it. Like ResolveNames, it goes only where CheckTree goes.
+ */
+void BuildScopes(Node *root) {
+    struct Pending { Node *node; Scope *scope; };
+    std::vector<Pending> stack;
+    std::vector<Node*> children;
+
+    Scope *top = new Scope;
+    top->loop = NULL;
+    top->fn = NULL;
+    top->cls = NULL;
+    stack.push_back((Pending){root, top});
+    while (!stack.empty()) {
+        Pending next = stack.back();
+        stack.pop_back();
+        Node *node = next.node;
+        if (node->GetKind() == TypeKind)
+            continue;
+        node->SetScope(next.scope);
+
+        Scope *inside = next.scope;
+        if (isa<LoopStmt>(node) || isa<FnDecl>(node) || isa<ClassDecl>(node)) {
+            inside = new Scope(*next.scope);
+            if (isa<LoopStmt>(node)) inside->loop = cast<LoopStmt>(node);
+            if (isa<FnDecl>(node)) inside->fn = cast<FnDecl>(node);
+            if (isa<ClassDecl>(node)) inside->cls = cast<ClassDecl>(node);
+        }
+        children.clear();
+        node->getCheckChildren(children);
+        for (int i = children.size() - 1; i >= 0; i--)
+            stack.push_back((Pending){children[i], inside});
+    }
+}
+
+int ResolveNames(Node *root) {
+    struct Pending { Node *node; bool childrenDone; bool scopeOpen; };
+    std::vector<Pending> stack;
+    std::vector<Node*> children;
+    SymbolTable symbols;
+    SymbolTable *outer = SymbolTable::Current();
+    SymbolTable::SetCurrent(&symbols);
+    int numResolved = 0;
+
+    stack.push_back((Pending){root, false, false});
+    while (!stack.empty()) {
+        Pending &top = stack.back();
+        Node *node = top.node;
+        if (top.childrenDone) {
+            if (top.scopeOpen)
+                symbols.CloseScope();
+            stack.pop_back();
+            continue;
+        }
+        top.childrenDone = true;
+        numResolved += node->resolveNames();
+        children.clear();
+        node->getCheckChildren(children);
+        top.scopeOpen = !children.empty() && node->openScope(&symbols);
+        for (int i = children.size() - 1; i >= 0; i--)
+            stack.push_back((Pending){children[i], false, false});
+    }
+    SymbolTable::SetCurrent(outer);
+    return numResolved;
+}
+
 //TODO
 //Lookup decl from local-most to global scope
 Decl *Identifier::checkDeclId() {
-	Decl *decl = NULL;
-	Node *parent = this->GetParent();
-	while (parent){
-		Hashtable<Decl*> *st = parent->getST();
-		if ((st != NULL) && ((decl = st->Lookup(this->name)) != NULL)) return decl;
-		
-		parent = parent->GetParent();
-	}
-	
-	return Program::st->Lookup(this->name);	
-}
-
-//Lookup decl in the fixed scope with a given name
-Decl *Identifier::checkDeclIdByName(Hashtable<Decl*> *st, const char *name){
-	return (st) ? (st->Lookup(name)) : NULL;
+	SymbolTable *symbols = SymbolTable::Current();
+	Decl *decl = symbols ? symbols->Lookup(this->name) : NULL;
+	Hashtable<Decl*> *globals = Program::Globals();
+	return (decl || !globals) ? decl : globals->Lookup(this->name);
 }
@@ -6,10 +6,23 @@
  * more correctly, of instances of concrete subclassses such as VarDecl,
  * ForStmt, and AssignExpr).
  * 
- * Location: Each node maintains its lexical location (line and columns in 
- * file), that location can be NULL for those nodes that don't care/use 
- * locations. The location is typcially set by the node constructor.  The 
- * location is used to provide the context when reporting semantic errors.
+ * Location: Each node maintains its lexical location (the span of source
+ * it came from, see location.h), that location can be NULL for those
+ * nodes that don't care/use locations. The location is typcially set by
+ * the node constructor.  The location is used to provide the context
+ * when reporting semantic errors.
+ *
+ * Storage: Nodes are allocated from the arena of
+ * the current compilation (see arena.h) and go away with it, all at
+ * once; deleting a node does nothing. Node classes therefore must not
+ * hold anything that needs a destructor, other than through pointers to
+ * objects that see to it themselves, as List and Hashtable do.
+ *
+ * Kind: Each node records which concrete class it is (see NodeKind
+ * below), set by its constructor. Code that needs to know what sort of
+ * node it has asks isa<ClassDecl>(node), and converts the pointer with
+ * cast<> or dyn_cast<>, in the manner of LLVM. These only compare the
+ * tag, where typeid and dynamic_cast go through the RTTI.
  *
  * Parent: Each node has a pointer to its parent. For a Program node, the 
  * parent is NULL, for all other nodes it is the pointer to the node one level
@@ -19,10 +32,22 @@
  * set up links in both directions. The parent link is typically not used 
  * during parsing, but is more important in later phases.
  *
+ * Scope: Once the tree is built, BuildScopes gives every node a pointer
+ * to a Scope record naming what encloses it (see below), so that the
+ * checks can find the loop, function and class a node is in without
+ * climbing parent pointers. Then ResolveNames finds the declaration
+ * each checked name refers to, once, and stores it in the name's Identifier,
+ * for the checks to read instead of looking the name up again. What is
+ * left to look up goes to the SymbolTable CheckTree keeps as it walks
+ * (see symtab.h).
+ *
  * Semantic analysis: For pp3 you are adding "Check" behavior to the ast
  * node classes. Your semantic analyzer should do an inorder walk on the
  * parse tree, and when visiting each node, verify the particular
- * semantic rules that apply to that construct.
+ * semantic rules that apply to that construct. The walk is done by
+ * CheckTree below, without recursion: each node names the children to
+ * be checked in getCheckChildren, and checkStmt checks the node itself
+ * once they have been.
 
  */
 
@@ -31,44 +56,130 @@
 
 #include <stdlib.h>   // for NULL
 #include "location.h"
+#include "utility.h"  // for Assert()
 #include "errors.h"
 #include "hashtable.h"
 #include "list.h"
+#include "nodelist.h"
+#include "arena.h"
 #include <iostream>
+#include <vector>
+
+/* Enum: NodeKind
+ * --------------
+ * One value for each concrete node class. A class with subclasses owns
+ * the run of values between its First and Last markers, so whether a
+ * node belongs to it is a range check (see the classof functions). The
+ * order must follow the class hierarchy in the ast_*.h files.
+ */
+class Decl;
+class LoopStmt;
+class FnDecl;
+class ClassDecl;
+struct Scope;
+class SymbolTable;
+
+typedef enum {
+    IdentifierKind, ErrorKind, OperatorKind, ProgramKind,
+
+    FirstDeclKind,
+    VarDeclKind = FirstDeclKind, ClassDeclKind, InterfaceDeclKind, FnDeclKind,
+    LastDeclKind = FnDeclKind,
+
+    FirstTypeKind,
+    TypeKind = FirstTypeKind, NamedTypeKind, ArrayTypeKind,
+    LastTypeKind = ArrayTypeKind,
+
+    FirstStmtKind,
+    StmtBlockKind = FirstStmtKind,
+      FirstConditionalStmtKind,
+      IfStmtKind = FirstConditionalStmtKind,
+        FirstLoopStmtKind,
+        ForStmtKind = FirstLoopStmtKind, WhileStmtKind,
+        LastLoopStmtKind = WhileStmtKind,
+      LastConditionalStmtKind = LastLoopStmtKind,
+    BreakStmtKind, ReturnStmtKind, PrintStmtKind,
+      FirstExprKind,
+      EmptyExprKind = FirstExprKind, IntConstantKind, DoubleConstantKind,
+      BoolConstantKind, StringConstantKind, NullConstantKind,
+        FirstCompoundExprKind,
+        ArithmeticExprKind = FirstCompoundExprKind, RelationalExprKind,
+        EqualityExprKind, LogicalExprKind, AssignExprKind,
+        LastCompoundExprKind = AssignExprKind,
+      ThisKind,
+        FirstLValueKind,
+        ArrayAccessKind = FirstLValueKind, FieldAccessKind,
+        LastLValueKind = FieldAccessKind,
+      CallKind, NewExprKind, NewArrayExprKind, ReadIntegerExprKind,
+      ReadLineExprKind,
+      LastExprKind = ReadLineExprKind,
+    LastStmtKind = LastExprKind
+} NodeKind;
+
 
 class Node 
 {
   protected:
-    yyltype *location;
+    yyltype location;   // first == 0 when there is none
     Node *parent;
+    Scope *scope;       // set by BuildScopes
+    NodeKind kind;
+    friend class AstImage;  // saves and restores the fields of nodes
 
   public:
-    Node(yyltype loc);
-    Node();
+    Node(NodeKind k, yyltype loc);
+    Node(NodeKind k);
     virtual ~Node() {}
+
+    static void *operator new(size_t size) { return ArenaAllocate(size); }
+    static void operator delete(void *p)   {}
     
-    yyltype *GetLocation()   { return location; }
-    void SetParent(Node *p)  { parent = p; }
+    yyltype *GetLocation()   { return location.first ? &location : NULL; }
+          // The built-in types (Type::intType and so on) are shared by
+          // every tree, even ones parsed on other threads, so they are
+          // given no parent.
+    void SetParent(Node *p)  { if (kind != TypeKind) parent = p; }
     Node *GetParent()        { return parent; }
+    Scope *GetScope()        { return scope; }
+    void SetScope(Scope *s)  { scope = s; }
+    NodeKind GetKind() const { return kind; }
 //TODO
 	virtual void checkDeclErr(){}
 	virtual void checkStmt(){}
-	virtual Hashtable<Decl*> *getST() {return NULL;}
+	virtual void getCheckChildren(std::vector<Node*> &children) {}
+          // Adds every child of the node, in order, for passes over the
+          // whole tree (getCheckChildren gives only those checked).
+    virtual void getChildren(std::vector<Node*> &children) {}
+          // Returns the member of a class or interface by that name.
+	virtual Decl *lookupMember(const char *name) {return NULL;}
+          // Opens a scope in symbols holding the names the node declares
+          // for its children, and returns true, or returns false if it
+          // declares none. The walks only open it if they go on into
+          // the node's children, and CheckTree closes it after the node.
+    virtual bool openScope(SymbolTable *symbols) { return false; }
+          // Resolves the names the node holds, as ResolveNames reaches
+          // it with the scopes around it open, and returns how many it
+          // bound.
+    virtual int resolveNames() { return 0; }
 };
    
 
 class Identifier : public Node 
 {
   protected:
-    char *name;
+    const char *name; // interned, compare with ==
+    Decl *decl;       // set by ResolveNames
+    friend class AstImage;
     
   public:
     Identifier(yyltype loc, const char *name);
+    static bool classof(const Node *n) { return n->GetKind() == IdentifierKind; }
     friend std::ostream& operator<<(std::ostream& out, Identifier *id) { return out << id->name; }
 //TODO
 	const char *getName() {return name;}
+	Decl *getDecl() {return decl;}
+	void setDecl(Decl *d) {decl = d;}
 	Decl *checkDeclId();
-	Decl *checkDeclIdByName(Hashtable<Decl*> *st, const char* name);
 };
 
 
@@ -80,9 +191,113 @@ class Identifier : public Node
 class Error : public Node
 {
   public:
-    Error() : Node() {}
+    Error() : Node(ErrorKind) {}
+    static bool classof(const Node *n) { return n->GetKind() == ErrorKind; }
+};
+
+
+/* Function: CheckTree
+ * --------------------
+ * Checks the tree under root in post order: the children a node gives
+ * from getCheckChildren are checked, first to last, before checkStmt is
+ * called on the node. The nodes waiting are kept on a stack on the
+ * heap, so the depth of the tree is limited only by memory. The scopes
+ * the nodes open are kept in a SymbolTable, which is current while the
+ * walk goes on.
+ *
+ * FnDecl gives no children to check, so for now the walk stops at each
+ * function's signature: the statements and expressions of its body are
+ * never checked, and the depth the walk can reach is that of classes
+ * and their members. The checkStmt of the nodes found in bodies, and
+ * the room the stack leaves for deep ones, come into use once function
+ * bodies are checked.
+ */
+void CheckTree(Node *root);
+
+
+/* Struct: Scope
+ * -------------
+ * What encloses a node: the nearest enclosing loop, function and class,
+ * each NULL if there is none. A node itself is not included, only its
+ * ancestors. A new record is only made below a loop, function or class,
+ * so most nodes share the record of their parent.
+ *
+ * The records are read only by checks on nodes inside function bodies
+ * (break, return, this and field access), and bodies are not checked
+ * yet (see CheckTree), so for now nothing reads them.
+ */
+struct Scope
+{
+    LoopStmt *loop;
+    FnDecl *fn;
+    ClassDecl *cls;
+
+    static void *operator new(size_t size) { return ArenaAllocate(size); }
+    static void operator delete(void *p)   {}
 };
 
 
+/* Function: BuildScopes
+ * ---------------------
+ * Sets the Scope of every node CheckTree will reach under root (and of
+ * root itself, which is taken to be at the top level), walking the tree
+ * once without recursion. The shared built-in types are left without
+ * one, and so are the nodes the checks never reach.
+ */
+void BuildScopes(Node *root);
+
+
+/* Function: ResolveNames
+ * ----------------------
+ * Binds the names in the tree under root to their declarations, in one
+ * walk without recursion that keeps the scopes in a SymbolTable as
+ * CheckTree does: the name a declaration declares to the declaration,
+ * and a field or function used without a base to what it means where it
+ * is. The global declarations must already be in Program::Globals.
+ *
+ * The walk goes only where CheckTree goes (getCheckChildren), so it does
+ * not go into function bodies until they are checked; a name the checks
+ * never read is not worth looking up. A type name is looked up the first
+ * time it is asked for (see NamedType::getDecl), and a field or method
+ * reached through a base is left for the check, which needs the base's
+ * type to find it. Returns how many names it bound.
+ *
+ * Until bodies are checked, what it binds is the declarations' own
+ * names. Fields and functions used without a base occur only in bodies,
+ * and so do the checks that read their bindings (Expr::getTypeDecl and
+ * its callers), so that part is not yet reached.
+ */
+int ResolveNames(Node *root);
+
+
+/* Functions: isa, cast, dyn_cast
+ * ------------------------------
+ * Tests and conversions on the kind of a node, for instance
+ *
+ *      if (isa<ClassDecl>(decl)) ...
+ *      FnDecl *fn = cast<FnDecl>(decl);         // must be an FnDecl
+ *      ClassDecl *cd = dyn_cast<ClassDecl>(d);  // NULL if it is not
+ *
+ * Each node class says which kinds belong to it with a static classof.
+ * The node given must not be NULL.
+ */
+template<class To> inline bool isa(const Node *n)
+{
+  Assert(n != NULL);
+  return To::classof(n);
+}
+
+template<class To> inline To *cast(Node *n)
+{
+  Assert(isa<To>(n));
+  return static_cast<To*>(n);
+}
+
+template<class To> inline To *dyn_cast(Node *n)
+{
+  return isa<To>(n) ? static_cast<To*>(n) : NULL;
+}
+
+
 
 #endif
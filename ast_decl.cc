@@ -6,19 +6,24 @@
 #include "ast_type.h"
 #include "ast_stmt.h"
 #include "errors.h"
+#include "symtab.h"
 
 #include <stdio.h>
 #include <string.h>
-#include <typeinfo>
         
          
-Decl::Decl(Identifier *n) : Node(*n->GetLocation()) {
+Decl::Decl(NodeKind k, Identifier *n) : Node(k, *n->GetLocation()) {
     Assert(n != NULL);
     (id=n)->SetParent(this); 
+    slot = -1;
+}
+
+void Decl::getChildren(std::vector<Node*> &children) {
+	children.push_back(id);
 }
 
 
-VarDecl::VarDecl(Identifier *n, Type *t) : Decl(n) {
+VarDecl::VarDecl(Identifier *n, Type *t) : Decl(VarDeclKind, n) {
     Assert(n != NULL && t != NULL);
     (type=t)->SetParent(this);
 }
@@ -31,105 +36,234 @@ bool VarDecl::hasSameType(VarDecl *vd){
 
 void VarDecl::checkStmt(){}
 
+void VarDecl::getChildren(std::vector<Node*> &children) {
+	Decl::getChildren(children);
+	children.push_back(type);
+}
+
 void VarDecl::checkDeclErr(){
 	if(type) type->checkTypeErr();
 }
 
-ClassDecl::ClassDecl(Identifier *n, NamedType *ex, List<NamedType*> *imp, List<Decl*> *m) : Decl(n) {
+ClassDecl::ClassDecl(Identifier *n, NamedType *ex, NodeList<NamedType*> *imp, NodeList<Decl*> *m) : Decl(ClassDeclKind, n) {
     // extends can be NULL, impl & mem may be empty lists but cannot be NULL
     Assert(n != NULL && imp != NULL && m != NULL);     
     extends = ex;
     if (extends) extends->SetParent(this);
     (implements=imp)->SetParentAll(this);
     (members=m)->SetParentAll(this);
-//TODO
-	st = new Hashtable<Decl*>;
+	base = firstSub = nextSub = NULL;
+	first = last = -1;
+	table = NULL;
+}
+
+MemberTable::MemberTable(MemberTable *b) {
+	base = b;
+	numFields = base ? base->numFields : 0;
+	numMethods = base ? base->numMethods : 0;
+}
+
+Decl *MemberTable::Declare(Decl *decl) {
+	const char *name = decl->getId()->getName();
+	Decl *prev = own.Lookup(name);
+	if (prev != NULL)
+		return prev;
+	own.Enter(name, decl);
+	if (isa<FnDecl>(decl)){
+		Decl *overridden = base ? base->Lookup(name) : NULL;
+		if (overridden && isa<FnDecl>(overridden))
+			decl->setSlot(overridden->getSlot());
+		else
+			decl->setSlot(numMethods++);
+	}
+	else
+		decl->setSlot(numFields++);
+	return decl;
+}
+
+Decl *MemberTable::Lookup(const char *name) {
+	for (MemberTable *t = this; t != NULL; t = t->base){
+		Decl *decl = t->own.Lookup(name);
+		if (decl != NULL)
+			return decl;
+	}
+	return NULL;
 }
 
 //TODO
-void ClassDecl::checkStmt(){
+void ClassDecl::getCheckChildren(std::vector<Node*> &children){
 	if (members){
 		for (int i = 0; i < members->NumElements(); ++i){
-			members->Nth(i)->checkStmt();
+			children.push_back(members->Nth(i));
 		}
 	}
 }
 
-void ClassDecl::checkDeclErr() {
-	st->Enter(this->getId()->getName(), this);
-	
-	if(members){
-		for (int i = 0; i < members->NumElements(); ++i){
-			Decl *cur = members->Nth(i);
-			Decl *prev;
-			const char *name = cur->getId()->getName();
-			if (name && ((prev = st->Lookup(name)) != NULL))
-				ReportError::DeclConflict(cur, prev);
-			else 	st->Enter(name, cur);
+void ClassDecl::getChildren(std::vector<Node*> &children) {
+	Decl::getChildren(children);
+	if (extends)
+		children.push_back(extends);
+	for (int i = 0; i < implements->NumElements(); ++i)
+		children.push_back(implements->Nth(i));
+	for (int i = 0; i < members->NumElements(); ++i)
+		children.push_back(members->Nth(i));
+}
+
+ClassDecl *ClassDecl::extendedClass() {
+	Decl *decl = extends ? extends->getDecl() : NULL;
+	return (decl && isa<ClassDecl>(decl)) ? cast<ClassDecl>(decl) : NULL;
+}
+
+/* Function: BuildHierarchy
+ * ------------------------
+ * Links the classes among decls into the inheritance forest and lays it
+ * out, in time linear in the number of classes, for the checks to use
+ * instead of following extends links again for each question.
+ *
+ * A class has at most one base, so a cycle is found by following bases
+ * from each class not yet seen until reaching a class already done, or
+ * one on the path being followed, which is where the path runs into a
+ * cycle. The cycle is reported once, there, and cut by leaving that
+ * class without a base. The forest is then walked depth first from its
+ * roots, parents before children, numbering the classes so that each
+ * class's descendants follow it and take the places up to its last,
+ * and building each class's member table on top of its base's.
+ */
+void ClassDecl::BuildHierarchy(NodeList<Decl*> *decls) {
+	std::vector<ClassDecl*> classes;
+	for (int i = 0; i < decls->NumElements(); ++i){
+		Decl *decl = decls->Nth(i);
+		if (isa<ClassDecl>(decl)){
+			ClassDecl *cls = cast<ClassDecl>(decl);
+			cls->base = cls->extendedClass();
+			cls->firstSub = cls->nextSub = NULL;
+			cls->first = cls->last = -1;
+			classes.push_back(cls);
 		}
 	}
 
+	// first is -1 for a class not yet seen, -2 while on the path
+	std::vector<ClassDecl*> path;
+	for (size_t i = 0; i < classes.size(); ++i){
+		ClassDecl *cls = classes[i];
+		while (cls != NULL && cls->first == -1){
+			cls->first = -2;
+			path.push_back(cls);
+			cls = cls->base;
+		}
+		if (cls != NULL && cls->first == -2){
+			ReportError::InheritanceCycle(cls, cls->extends);
+			cls->base = NULL;
+		}
+		for (size_t j = 0; j < path.size(); ++j)
+			path[j]->first = 0;
+		path.clear();
+	}
 
-	NamedType *ext = extends;
-	while(ext){
-		const char *name = ext->getId()->getName();
-		if (name){
-			Node *node = Program::st->Lookup(name);
-			if (node == NULL) {
-				ReportError::IdentifierNotDeclared(ext->getId(), LookingForClass);
-				break;
-			}else if (typeid(*node) == typeid(ClassDecl)){
-				ClassDecl *base = dynamic_cast<ClassDecl*>(node);
-				List<Decl*> *baseMembers = base->members;
-				List<Decl*> *inherited = new List<Decl*>;
-				if (baseMembers){
-					for (int i = 0; i < baseMembers->NumElements(); ++i){
-						Decl *cur = baseMembers->Nth(i);
-						Decl *prev;
-						const char *name = cur->getId()->getName();
-						if ((prev = st->Lookup(name)) != NULL){
-							if (typeid(*cur) == typeid(VarDecl) || typeid(*cur) != typeid(*prev))
-								ReportError::DeclConflict(prev, cur);
-							else if (typeid(*cur) == typeid(FnDecl) && typeid(*cur) == typeid(*prev)){
-								FnDecl *fdcur = dynamic_cast<FnDecl*>(cur);
-								FnDecl *fdprev = dynamic_cast<FnDecl*>(prev);
-								if (!fdcur->hasSameType(fdprev))
-									ReportError::OverrideMismatch(fdprev);
-							}
-						}
-						else inherited->Append(cur);
-					}
-					
-					for (int i = 0; i < inherited->NumElements(); ++i){
-						Decl *decl = inherited->Nth(i);
-						st->Enter(decl->getId()->getName(), decl);
-					}
-				}
-				ext = base->getExt();
+	for (size_t i = 0; i < classes.size(); ++i){
+		ClassDecl *cls = classes[i];
+		if (cls->base){
+			cls->nextSub = cls->base->firstSub;
+			cls->base->firstSub = cls;
+		}
+	}
+
+	struct Pending { ClassDecl *cls; bool subsDone; };
+	std::vector<Pending> stack;
+	int next = 0;
+	for (size_t i = 0; i < classes.size(); ++i){
+		if (classes[i]->base != NULL)
+			continue;
+		stack.push_back((Pending){classes[i], false});
+		while (!stack.empty()){
+			Pending &top = stack.back();
+			ClassDecl *cls = top.cls;
+			if (top.subsDone){
+				cls->last = next - 1;
+				stack.pop_back();
+				continue;
 			}
+			top.subsDone = true;
+			cls->first = next++;
+			cls->table = new MemberTable(cls->base ? cls->base->table : NULL);
+			for (int j = 0; j < cls->members->NumElements(); ++j){
+				Decl *cur = cls->members->Nth(j);
+				const char *name = cur->getId()->getName();
+				if (name && name != cls->getId()->getName())
+					cls->table->Declare(cur);
+			}
+			for (ClassDecl *sub = cls->firstSub; sub != NULL; sub = sub->nextSub)
+				stack.push_back((Pending){sub, false});
 		}
 	}
+}
+
+Decl *ClassDecl::lookupMember(const char *name) {
+	return table ? table->Lookup(name) : NULL;
+}
+
+/* Function: checkDeclErr
+ * ----------------------
+ * Each member is checked against those the class inherits from its
+ * base's table, which already has everything above it, so the class's
+ * ancestors are not gone through again here; conflicts between them are
+ * reported when the ancestor that has them is checked.
+ *
+ * So a member is reported once, against the nearest member it inherits
+ * by its name (the first, where a class declares the name twice), and
+ * an undeclared base only for the class that names it, not again for
+ * each of that class's descendants. A class's errors come out in the
+ * order of its members. samples/inherit.decaf pins this down.
+ */
+void ClassDecl::checkDeclErr() {
+	Assert(table != NULL);
+	const char *className = this->getId()->getName();
+
+	for (int i = 0; i < members->NumElements(); ++i){
+		Decl *cur = members->Nth(i);
+		const char *name = cur->getId()->getName();
+		Decl *prev = (name == className) ? this : table->LookupOwn(name);
+		if (name && prev != cur)
+			ReportError::DeclConflict(cur, prev);
+	}
+
+	if (extends && extendedClass() == NULL)
+		ReportError::IdentifierNotDeclared(extends->getId(), LookingForClass);
+
+	MemberTable *inherited = table->GetBase();
+	for (int i = 0; inherited && i < members->NumElements(); ++i){
+		Decl *cur = members->Nth(i);
+		const char *name = cur->getId()->getName();
+		Decl *prev;
+		if (table->LookupOwn(name) != cur || (prev = inherited->Lookup(name)) == NULL)
+			continue;
+		if (isa<VarDecl>(prev) || cur->GetKind() != prev->GetKind())
+			ReportError::DeclConflict(cur, prev);
+		else if (!cast<FnDecl>(prev)->hasSameType(cast<FnDecl>(cur)))
+			ReportError::OverrideMismatch(cur);
+	}
 	
 	if (implements){
 		for (int i = 0; i < implements->NumElements(); ++i){
 			NamedType *implement = implements->Nth(i);
 			Identifier *id = implement->getId();
 			if (id){
-				Node *n = Program::st->Lookup(id->getName());
-				if (n == NULL || (typeid(*n) != typeid(InterfaceDecl)))
+				Node *n = implement->getDecl();
+				if (n == NULL || !isa<InterfaceDecl>(n))
 					ReportError::IdentifierNotDeclared(id, LookingForInterface);
-				else if (typeid(*n) == typeid(InterfaceDecl)){
-					InterfaceDecl *interfd = dynamic_cast<InterfaceDecl*>(n);
-					List<Decl*> *members = interfd->getMembers();
+				else if (isa<InterfaceDecl>(n)){
+					InterfaceDecl *interfd = cast<InterfaceDecl>(n);
+					NodeList<Decl*> *members = interfd->getMembers();
 					for (int j = 0; j < members->NumElements(); ++j){
-						FnDecl *cur = dynamic_cast<FnDecl*>(members->Nth(j));
+						FnDecl *cur = cast<FnDecl>(members->Nth(j));
 						Decl *prev;
 						const char *name = cur->getId()->getName();
 						
-						if ((prev = st->Lookup(name)) != NULL){
-							if (typeid(*prev) != typeid(FnDecl))
+						prev = (name == className) ? this : table->Lookup(name);
+						if (prev != NULL){
+							if (!isa<FnDecl>(prev))
 								ReportError::DeclConflict(cur, prev);
-							else if (!cur->hasSameType(dynamic_cast<FnDecl*>(prev)))
+							else if (!cur->hasSameType(cast<FnDecl>(prev)))
 								ReportError::OverrideMismatch(prev);
 						}
 						else ReportError::InterfaceNotImplemented(this, implement);
@@ -146,51 +280,33 @@ void ClassDecl::checkDeclErr() {
 }
 
 
+/* Function: IsCompatibleWith
+ * ---------------------------
+ * A class is compatible with its proper ancestors, which are the classes
+ * whose range in the hierarchy's order holds its place, and with every
+ * interface it or one of them implements.
+ */
 bool ClassDecl::IsCompatibleWith(Decl *decl){
-	NamedType *ext = this->getExt();
-  	List<NamedType*> *imp = this->getImp();
-
-	if (typeid(*decl) == typeid(ClassDecl)){
-		ClassDecl *clsd = dynamic_cast<ClassDecl*>(decl);
-
-		if (ext){
-			const char *name = ext->getTypeName();
-			if (!strcmp(clsd->getId()->getName(), name))
-				return true;
-			else{
-				if (name){
-					Decl *extd = Program::st->Lookup(name);
-					if (extd && typeid(*extd) == typeid(ClassDecl))
-						return dynamic_cast<ClassDecl*>(extd)->IsCompatibleWith(decl);
-				}
-			}
-		}
+	if (isa<ClassDecl>(decl)){
+		ClassDecl *clsd = cast<ClassDecl>(decl);
+		return clsd->first >= 0 && clsd->first < first && first <= clsd->last;
 	}
-	else if (typeid(*decl) == typeid(InterfaceDecl)){
-		InterfaceDecl *interfd = dynamic_cast<InterfaceDecl*>(decl);
-		
-		if (imp){
+	else if (isa<InterfaceDecl>(decl)){
+		const char *name = decl->getId()->getName();
+		for (ClassDecl *cls = this; cls != NULL; cls = cls->base){
+			NodeList<NamedType*> *imp = cls->getImp();
 			for (int i = 0; i < imp->NumElements(); ++i){
 				NamedType *implement = imp->Nth(i);
-				if (implement && !strcmp(interfd->getId()->getName(), implement->getTypeName()))
+				if (implement && name == implement->getTypeName())
 					return true;
 			}
 		}
-
-		if(ext){
-			const char *name = ext->getTypeName();
-			if (name) {
-				Decl *extd = Program::st->Lookup(name);
-				if (extd && typeid(*extd) == typeid(ClassDecl))
-					return dynamic_cast<ClassDecl*>(extd)->IsCompatibleWith(decl);
-			}
-		}
 	}
 
 	return false;
 }	
 
-InterfaceDecl::InterfaceDecl(Identifier *n, List<Decl*> *m) : Decl(n) {
+InterfaceDecl::InterfaceDecl(Identifier *n, NodeList<Decl*> *m) : Decl(InterfaceDeclKind, n) {
     Assert(n != NULL && m != NULL);
     (members=m)->SetParentAll(this);
 //TODO
@@ -218,14 +334,18 @@ void InterfaceDecl::checkDeclErr() {
 void InterfaceDecl::checkStmt() {
     
 }
+
+void InterfaceDecl::getChildren(std::vector<Node*> &children) {
+	Decl::getChildren(children);
+	for (int i = 0; i < members->NumElements(); ++i)
+		children.push_back(members->Nth(i));
+}
 	
-FnDecl::FnDecl(Identifier *n, Type *r, List<VarDecl*> *d) : Decl(n) {
+FnDecl::FnDecl(Identifier *n, Type *r, NodeList<VarDecl*> *d) : Decl(FnDeclKind, n) {
     Assert(n != NULL && r!= NULL && d != NULL);
     (returnType=r)->SetParent(this);
     (formals=d)->SetParentAll(this);
     body = NULL;
-//TODO
-	st = new Hashtable<Decl*>;
 }
 
 void FnDecl::SetFunctionBody(Stmt *b) { 
@@ -234,10 +354,10 @@ void FnDecl::SetFunctionBody(Stmt *b) {
 
 //TODO
 bool FnDecl::hasSameType(FnDecl *fd){
-	if (!strcmp(id->getName(), fd->getId()->getName())){
+	if (id->getName() == fd->getId()->getName()){
 		if (returnType->hasSameType(fd->getType())){
-			List<VarDecl*> *fmList = formals;
-			List<VarDecl*> *fdList = fd->getFormals();
+			NodeList<VarDecl*> *fmList = formals;
+			NodeList<VarDecl*> *fdList = fd->getFormals();
 			if (fmList && fdList){
 				if (fmList->NumElements() == fdList->NumElements()){
 					for (int i = 0; i < fmList->NumElements(); ++i){
@@ -254,6 +374,19 @@ bool FnDecl::hasSameType(FnDecl *fd){
 	return false;
 }
 
+bool FnDecl::openScope(SymbolTable *symbols) {
+	if (formals->NumElements() == 0)
+		return false;
+	symbols->OpenScope();
+	for (int i = 0; i < formals->NumElements(); ++i){
+		VarDecl *cur = formals->Nth(i);
+		const char *name = cur->getId()->getName();
+		if (name && !symbols->LookupInScope(name))
+			symbols->Enter(name, cur);
+	}
+	return true;
+}
+
 void FnDecl::checkDeclErr(){
 
 }
@@ -262,5 +395,14 @@ void FnDecl::checkStmt(){
 
 }
 
+void FnDecl::getChildren(std::vector<Node*> &children) {
+	Decl::getChildren(children);
+	children.push_back(returnType);
+	for (int i = 0; i < formals->NumElements(); ++i)
+		children.push_back(formals->Nth(i));
+	if (body)
+		children.push_back(body);
+}
+
 
 
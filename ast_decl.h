@@ -14,7 +14,7 @@
 #define _H_ast_decl
 
 #include "ast.h"
-#include "list.h"
+#include "nodelist.h"
 #include "ast_type.h"
 #include "hashtable.h"
 
@@ -27,12 +27,20 @@ class Decl : public Node
 {
   protected:
     Identifier *id;
+    int slot;           // set by MemberTable::Declare, else -1
+    friend class AstImage;
   
   public:
-    Decl(Identifier *name);
+    Decl(NodeKind k, Identifier *name);
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstDeclKind && n->GetKind() <= LastDeclKind; }
     friend std::ostream& operator<<(std::ostream& out, Decl *d) { return out << d->id; }
 
 	Identifier *getId() {return id;}
+	int getSlot() {return slot;}
+	void setSlot(int s) {slot = s;}
+	void getChildren(std::vector<Node*> &children);
+	int resolveNames() { id->setDecl(this); return 1; }
 	virtual const char *getTypeName() {return NULL;}
 	virtual Type *getType() { return NULL; }
 };
@@ -41,74 +49,148 @@ class VarDecl : public Decl
 {
   protected:
     Type *type;
+    friend class AstImage;
     
   public:
     VarDecl(Identifier *name, Type *type);
+    static bool classof(const Node *n) { return n->GetKind() == VarDeclKind; }
 //TODO
 	Type *getType() {return type;}
 	const char *getTypeName() {return type->getTypeName();}
 	bool hasSameType(VarDecl *vd);
 	void checkDeclErr();
 	void checkStmt();
+	void getChildren(std::vector<Node*> &children);
+};
+
+/* Class: MemberTable
+ * ------------------
+ * The members of a class, those it declares and those it inherits. A
+ * table holds only the members its own class declares and refers to its
+ * base class's table for the rest, so building it copies nothing and
+ * the tables of a hierarchy take space in proportion to the members
+ * declared in it. Finding a member takes a probe for each class up to
+ * the nearest that declares it.
+ *
+ * Each field and method is given a slot, numbered densely through the
+ * hierarchy as fields and a vtable would be laid out: a class's new
+ * fields and methods are numbered on from its base's, and a method that
+ * overrides an inherited one takes that one's slot.
+ */
+class MemberTable
+{
+  public:
+    MemberTable(MemberTable *base);
+
+          // Tables are allocated from the current compilation's arena,
+          // which destroys them when it is released.
+    static void *operator new(size_t size)
+        { return ArenaAllocate(size, Destroy); }
+    static void operator delete(void *p) {}
+
+    MemberTable *GetBase() { return base; }
+
+          // Enters decl as a member the class declares and gives it its
+          // slot, unless the class already declares one by its name, in
+          // which case the first one is kept. Returns the one kept.
+    Decl *Declare(Decl *decl);
+
+          // Returns the member the class declares by that name, or NULL.
+    Decl *LookupOwn(const char *name) { return own.Lookup(name); }
+
+          // Returns the member by that name from the class or, failing
+          // that, its nearest base class that has one, or NULL.
+    Decl *Lookup(const char *name);
+
+    int NumFields() { return numFields; }
+    int NumMethods() { return numMethods; }
+
+  private:
+    MemberTable *base;      // shared with the base class, NULL at a root
+    Hashtable<Decl*> own;
+    int numFields, numMethods;  // slots used, counting the base's
+
+    static void Destroy(void *p)
+        { ((MemberTable *)p)->~MemberTable(); }
 };
 
 class ClassDecl : public Decl 
 {
   protected:
-    List<Decl*> *members;
+    NodeList<Decl*> *members;
     NamedType *extends;
-    List<NamedType*> *implements;
+    NodeList<NamedType*> *implements;
 
-	Hashtable<Decl*> *st;
+	// Set by BuildHierarchy: the base class, unless there is none or
+	// the class closes a cycle, the first of its subclasses and the
+	// next of its base's, and the range of places in the hierarchy's
+	// order taken by the class and its descendants.
+	ClassDecl *base, *firstSub, *nextSub;
+	int first, last;
+	MemberTable *table;	// set by BuildHierarchy
+    friend class AstImage;
+
+	ClassDecl *extendedClass();
 
   public:
     ClassDecl(Identifier *name, NamedType *extends, 
-              List<NamedType*> *implements, List<Decl*> *members);
+              NodeList<NamedType*> *implements, NodeList<Decl*> *members);
+    static bool classof(const Node *n) { return n->GetKind() == ClassDeclKind; }
 //TODO
 	NamedType *getExt() {return extends;}
-	List<NamedType*> *getImp() {return implements;}
-	Hashtable<Decl*> *getST () {return st;}
+	NodeList<NamedType*> *getImp() {return implements;}
+	ClassDecl *getBaseClass() {return base;}
+	MemberTable *getMemberTable() {return table;}
+	static void BuildHierarchy(NodeList<Decl*> *decls);
+	Decl *lookupMember(const char *name);
+	// A class opens no scope: only code in function bodies names a
+	// member bare, and bodies are not checked yet.
 	bool IsCompatibleWith(Decl *decl);
 	void checkDeclErr();
-	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 };
 
 class InterfaceDecl : public Decl 
 {
   protected:
-    List<Decl*> *members;
+    NodeList<Decl*> *members;
 //TODO
 	Hashtable<Decl*> *st;
+    friend class AstImage;
     
   public:
-    InterfaceDecl(Identifier *name, List<Decl*> *members);
+    InterfaceDecl(Identifier *name, NodeList<Decl*> *members);
+    static bool classof(const Node *n) { return n->GetKind() == InterfaceDeclKind; }
 //TODO
-	List<Decl*> *getMembers() {return members;}
-	Hashtable<Decl*> *getST() {return st;}
+	NodeList<Decl*> *getMembers() {return members;}
+	Decl *lookupMember(const char *name) {return st->Lookup(name);}
 	void checkDeclErr();
 	void checkStmt();	
+	void getChildren(std::vector<Node*> &children);
 };
 
 class FnDecl : public Decl 
 {
   protected:
-    List<VarDecl*> *formals;
+    NodeList<VarDecl*> *formals;
     Type *returnType;
     Stmt *body;
-//TODO
-	Hashtable<Decl*> *st;
+    friend class AstImage;
     
   public:
-    FnDecl(Identifier *name, Type *returnType, List<VarDecl*> *formals);
+    FnDecl(Identifier *name, Type *returnType, NodeList<VarDecl*> *formals);
+    static bool classof(const Node *n) { return n->GetKind() == FnDeclKind; }
     void SetFunctionBody(Stmt *b);
 //TODO
 	Type *getType() {return returnType;}
 	const char *getTypeName() {return returnType->getTypeName();}
-	List<VarDecl*> *getFormals() {return formals;}
-	Hashtable<Decl*> *getST() {return st;}
+	NodeList<VarDecl*> *getFormals() {return formals;}
+	bool openScope(SymbolTable *symbols);
 	bool hasSameType(FnDecl *fd);
 	void checkDeclErr();
 	void checkStmt();	
+	void getChildren(std::vector<Node*> &children);
 	
 };
 
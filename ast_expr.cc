@@ -6,46 +6,52 @@
 #include "ast_type.h"
 #include "ast_decl.h"
 #include "errors.h"
+#include "intern.h"
 #include <string.h>
-#include <typeinfo>
+
+
+Decl *Expr::getTypeDecl() {
+	Type *t = getType();
+	return t ? t->getDecl() : NULL;
+}
         
 
-IntConstant::IntConstant(yyltype loc, int val) : Expr(loc) {
+IntConstant::IntConstant(yyltype loc, int val) : Expr(IntConstantKind, loc) {
     value = val;
 	Expr::type = Type::intType;
 }
 
-DoubleConstant::DoubleConstant(yyltype loc, double val) : Expr(loc) {
+DoubleConstant::DoubleConstant(yyltype loc, double val) : Expr(DoubleConstantKind, loc) {
     value = val;
 	Expr::type = Type::doubleType;
 }
 
-BoolConstant::BoolConstant(yyltype loc, bool val) : Expr(loc) {
+BoolConstant::BoolConstant(yyltype loc, bool val) : Expr(BoolConstantKind, loc) {
     value = val;
 	Expr::type = Type::boolType;
 }
 
-StringConstant::StringConstant(yyltype loc, const char *val) : Expr(loc) {
+StringConstant::StringConstant(yyltype loc, const char *val) : Expr(StringConstantKind, loc) {
     Assert(val != NULL);
-    value = strdup(val);
+    value = Intern(val);
 	Expr::type = Type::stringType;
 }
 
 
-Operator::Operator(yyltype loc, const char *tok) : Node(loc) {
+Operator::Operator(yyltype loc, const char *tok) : Node(OperatorKind, loc) {
     Assert(tok != NULL);
     strncpy(tokenString, tok, sizeof(tokenString));
 }
-CompoundExpr::CompoundExpr(Expr *l, Operator *o, Expr *r) 
-  : Expr(Join(l->GetLocation(), r->GetLocation())) {
+CompoundExpr::CompoundExpr(NodeKind k, Expr *l, Operator *o, Expr *r) 
+  : Expr(k, Join(l->GetLocation(), r->GetLocation())) {
     Assert(l != NULL && o != NULL && r != NULL);
     (op=o)->SetParent(this);
     (left=l)->SetParent(this); 
     (right=r)->SetParent(this);
 }
 
-CompoundExpr::CompoundExpr(Operator *o, Expr *r) 
-  : Expr(Join(o->GetLocation(), r->GetLocation())) {
+CompoundExpr::CompoundExpr(NodeKind k, Operator *o, Expr *r) 
+  : Expr(k, Join(o->GetLocation(), r->GetLocation())) {
     Assert(o != NULL && r != NULL);
     left = NULL; 
     (op=o)->SetParent(this);
@@ -53,14 +59,24 @@ CompoundExpr::CompoundExpr(Operator *o, Expr *r)
 }
    
 //TODO
+void CompoundExpr::getCheckChildren(std::vector<Node*> &children) {
+	if (left)
+		children.push_back(left);
+	children.push_back(right);
+}
+
+void CompoundExpr::getChildren(std::vector<Node*> &children) {
+	if (left)
+		children.push_back(left);
+	children.push_back(op);
+	children.push_back(right);
+}
+
 void ArithmeticExpr::checkStmt() {
 	const char *lt = NULL, *rt = NULL;
-	if (left){
-		left->checkStmt();
+	if (left)
 		lt = left->getTypeName();
-	}
 
-	right->checkStmt();
 	rt = right->getTypeName();
 	if (lt && rt){
 		if ((strcmp(lt, "int") && strcmp(lt, "double")) ||
@@ -76,10 +92,7 @@ void ArithmeticExpr::checkStmt() {
 
 
 void RelationalExpr::checkStmt() {
-	left->checkStmt();
 	const char *lt = left->getTypeName();
-    
-	right->checkStmt();
 	const char *rt = right->getTypeName();
     
 	if (lt && rt){
@@ -92,25 +105,22 @@ void RelationalExpr::checkStmt() {
 
 
 void EqualityExpr::checkStmt() {
-	left->checkStmt();
     	const char *lt = left->getTypeName();
-
-	right->checkStmt();
 	const char *rt = right->getTypeName();
 	if (lt && rt){
-		Decl *ld = Program::st->Lookup(lt);
-		Decl *rd = Program::st->Lookup(rt);
+		Decl *ld = left->getTypeDecl();
+		Decl *rd = right->getTypeDecl();
         
 		if (ld && rd){
 			if (!strcmp(lt, rt))
 				return;
-			else if (typeid(*ld) == typeid(ClassDecl)){
-				ClassDecl *lClsd = dynamic_cast<ClassDecl*>(ld);
+			else if (isa<ClassDecl>(ld)){
+				ClassDecl *lClsd = cast<ClassDecl>(ld);
 				if (lClsd->IsCompatibleWith(rd))
 					return;
 			}
-            		else if (typeid(*rd) == typeid(ClassDecl)){
-				ClassDecl *rClsd = dynamic_cast<ClassDecl*>(rd);
+            		else if (isa<ClassDecl>(rd)){
+				ClassDecl *rClsd = cast<ClassDecl>(rd);
 				if (rClsd->IsCompatibleWith(ld))
 					return;
 			}
@@ -126,12 +136,9 @@ void EqualityExpr::checkStmt() {
 
 void LogicalExpr::checkStmt() {
 	const char *lt = NULL, *rt = NULL;
-	if (left){
-		left->checkStmt();
+	if (left)
 		lt = left->getTypeName();
-	}
 
-	right->checkStmt();
 	rt = right->getTypeName();
 
 	if (lt && rt){
@@ -146,20 +153,18 @@ void LogicalExpr::checkStmt() {
 
 
 void AssignExpr::checkStmt() {
-	left->checkStmt();
 	const char *lt = this->left->getTypeName();
-	right->checkStmt();
 	const char *rt = this->right->getTypeName();
     
 	if (lt && rt){
-		Decl *ld = Program::st->Lookup(lt);
-		Decl *rd = Program::st->Lookup(rt);
+		Decl *ld = left->getTypeDecl();
+		Decl *rd = right->getTypeDecl();
 		
 		if (ld && rd){
 			if (!strcmp(lt, rt))
 				return;
-			else if (typeid(*rd) == typeid(ClassDecl)){
-				ClassDecl *rClsd = dynamic_cast<ClassDecl*>(rd);
+			else if (isa<ClassDecl>(rd)){
+				ClassDecl *rClsd = cast<ClassDecl>(rd);
 				if (rClsd->IsCompatibleWith(ld))
 					return;
 			}
@@ -175,19 +180,16 @@ void AssignExpr::checkStmt() {
 
 
 void This::checkStmt() {
-	Node *parent = this->GetParent();
-	while (parent){
-		if (typeid(*parent) == typeid(ClassDecl)){
-			type = new NamedType(dynamic_cast<ClassDecl*>(parent)->getId());
-			return;
-		}
-	parent = parent->GetParent();
+	ClassDecl *cls = scope->cls;
+	if (cls){
+		type = new NamedType(cls->getId());
+		return;
 	}
 
 	ReportError::ThisOutsideClassScope(this);
 }
 
-ArrayAccess::ArrayAccess(yyltype loc, Expr *b, Expr *s) : LValue(loc) {
+ArrayAccess::ArrayAccess(yyltype loc, Expr *b, Expr *s) : LValue(ArrayAccessKind, loc) {
     (base=b)->SetParent(this); 
     (subscript=s)->SetParent(this);
 }
@@ -208,18 +210,22 @@ const char *ArrayAccess::getTypeName() {
     return NULL;
 }
 
+void ArrayAccess::getCheckChildren(std::vector<Node*> &children){
+	children.push_back(base);
+	children.push_back(subscript);
+}
+
 void ArrayAccess::checkStmt(){
-	base->checkStmt();
-	if(typeid(this->type) != typeid(ArrayType))
+	Type *baseType = base->getType();
+	if (baseType == NULL || !isa<ArrayType>(baseType))
 		ReportError::BracketsOnNonArray(base);
     
-	subscript->checkStmt();
 	if (strcmp(subscript->getTypeName(), "int"))
 		ReportError::SubscriptNotInteger(this->subscript);
 }
      
 FieldAccess::FieldAccess(Expr *b, Identifier *f) 
-  : LValue(b? Join(b->GetLocation(), f->GetLocation()) : *f->GetLocation()) {
+  : LValue(FieldAccessKind, b? Join(b->GetLocation(), f->GetLocation()) : *f->GetLocation()) {
     Assert(f != NULL); // b can be be NULL (just means no explicit base)
     base = b; 
     if (base) base->SetParent(this); 
@@ -227,32 +233,52 @@ FieldAccess::FieldAccess(Expr *b, Identifier *f)
 }
 
 
+void FieldAccess::getCheckChildren(std::vector<Node*> &children) {
+	if (base)
+		children.push_back(base);
+}
+
+void FieldAccess::getChildren(std::vector<Node*> &children) {
+	if (base)
+		children.push_back(base);
+	children.push_back(field);
+}
+
+/* Function: resolveNames
+ * -----------------------
+ * Only a field used without a base can be resolved ahead of the check;
+ * what a base's field is depends on the base's type. If the check
+ * reaches the field before it has been resolved, it looks it up itself.
+ */
+int FieldAccess::resolveNames() {
+	if (base)
+		return 0;
+	field->setDecl(field->checkDeclId());
+	return field->getDecl() != NULL;
+}
+
 void FieldAccess::checkStmt() {
 	Decl *decl = NULL;
 	if (base){
-		base->checkStmt();        
 		const char *basetype = base->getTypeName();
 		
 		if (basetype){
-			Node *parent = this->GetParent();
+			// A field can only be reached from inside its own class, so
+			// it is accessible only if the base is of the enclosing class.
+			ClassDecl *cls = scope->cls;
 			Decl *classLoc = NULL;
             
-			while (parent){
-				Hashtable<Decl*> *st = parent->getST();
-				if (st){
-					if ((classLoc = st->Lookup(basetype)) != NULL){
-						decl = field->checkDeclIdByName(classLoc->getST(), field->getName());
-						if ((decl == NULL) || (typeid(*decl) != typeid(VarDecl)))
-							ReportError::FieldNotFoundInBase(field, new Type(basetype));
-					}
-				}
-				parent = parent->GetParent();
+			if (cls && !strcmp(cls->getId()->getName(), basetype)){
+				classLoc = cls;
+				decl = classLoc->lookupMember(field->getName());
+				if ((decl == NULL) || !isa<VarDecl>(decl))
+					ReportError::FieldNotFoundInBase(field, new Type(basetype));
 			}
 
 			if (classLoc == NULL){
-				if ((classLoc = Program::st->Lookup(basetype)) != NULL){
-					decl = field->checkDeclIdByName(classLoc->getST(), field->getName());
-					if ((decl != NULL) && (typeid(*decl) == typeid(VarDecl)))
+				if ((classLoc = base->getTypeDecl()) != NULL){
+					decl = classLoc->lookupMember(field->getName());
+					if ((decl != NULL) && (isa<VarDecl>(decl)))
 						ReportError::InaccessibleField(field, new Type(basetype));
 					else
 						ReportError::FieldNotFoundInBase(field, new Type(basetype));
@@ -263,8 +289,9 @@ void FieldAccess::checkStmt() {
 		}
 	}
 	else{
-		decl = field->checkDeclId();
-		if (decl == NULL || typeid(*decl) != typeid(VarDecl)){
+		if ((decl = field->getDecl()) == NULL)
+			decl = field->checkDeclId();
+		if (decl == NULL || !isa<VarDecl>(decl)){
 			ReportError::IdentifierNotDeclared(field, LookingForVariable);
 			decl = NULL;
 		}
@@ -274,7 +301,7 @@ void FieldAccess::checkStmt() {
 
 }
 
-Call::Call(yyltype loc, Expr *b, Identifier *f, List<Expr*> *a) : Expr(loc)  {
+Call::Call(yyltype loc, Expr *b, Identifier *f, NodeList<Expr*> *a) : Expr(CallKind, loc)  {
     Assert(f != NULL && a != NULL); // b can be be NULL (just means no explicit base)
     base = b;
     if (base) base->SetParent(this);
@@ -284,7 +311,7 @@ Call::Call(yyltype loc, Expr *b, Identifier *f, List<Expr*> *a) : Expr(loc)  {
 
 
 void Call::checkArgs(FnDecl *fndecl) {
-	List<VarDecl*> *formals = fndecl->getFormals();
+	NodeList<VarDecl*> *formals = fndecl->getFormals();
 	int formalNum = formals->NumElements();
 	int actualNum = actuals->NumElements();
 	if (formalNum != actualNum){
@@ -299,13 +326,13 @@ void Call::checkArgs(FnDecl *fndecl) {
 			const char *ct = expr->getTypeName();
             
 			if (et && ct){
-				Decl *gd = Program::st->Lookup(ct);
-				Decl *ed = Program::st->Lookup(et);
+				Decl *gd = expr->getTypeDecl();
+				Decl *ed = vardecl->getType()->getDecl();
                 
 				if (gd && ed){
 					if (strcmp(et, ct)){
-						if (typeid(*gd) == typeid(ClassDecl)){
-							ClassDecl *gClsd = dynamic_cast<ClassDecl*>(gd);
+						if (isa<ClassDecl>(gd)){
+							ClassDecl *gClsd = cast<ClassDecl>(gd);
 							if (!gClsd->IsCompatibleWith(ed))
                                 				ReportError::ArgMismatch(expr, (i+1), new Type(ct), new Type(et));
                         			}
@@ -321,27 +348,46 @@ void Call::checkArgs(FnDecl *fndecl) {
 }
 
 
-void Call::checkStmt() {
+void Call::getCheckChildren(std::vector<Node*> &children) {
 	if (actuals){
 		for (int i = 0; i < actuals->NumElements(); ++i)
-			actuals->Nth(i)->checkStmt();
+			children.push_back(actuals->Nth(i));
 	}
+	if (base)
+		children.push_back(base);
+}
+
+void Call::getChildren(std::vector<Node*> &children) {
+	if (base)
+		children.push_back(base);
+	children.push_back(field);
+	for (int i = 0; i < actuals->NumElements(); ++i)
+		children.push_back(actuals->Nth(i));
+}
+
+int Call::resolveNames() {
+	if (base)
+		return 0;
+	field->setDecl(field->checkDeclId());
+	return field->getDecl() != NULL;
+}
+
+void Call::checkStmt() {
 
 	Decl *decl = NULL;
 
 	if (base){
-		base->checkStmt();
 		const char *name = base->getTypeName();
 		
 		if (name){
-			if ((decl = Program::st->Lookup(name)) != NULL){
-				decl = field->checkDeclIdByName(decl->getST(), field->getName());
-				if ((decl == NULL) || (typeid(*decl) != typeid(FnDecl)))
+			if ((decl = base->getTypeDecl()) != NULL){
+				decl = decl->lookupMember(field->getName());
+				if ((decl == NULL) || !isa<FnDecl>(decl))
 					ReportError::FieldNotFoundInBase(field, new Type(name));
 				else
-					checkArgs(dynamic_cast<FnDecl*>(decl));
+					checkArgs(cast<FnDecl>(decl));
 			}
-			else if ((typeid(*base->getType()) == typeid(ArrayType)) && 
+			else if ((isa<ArrayType>(base->getType())) && 
 				!strcmp(field->getName(), "length")){
 				type = Type::intType;
 			}
@@ -351,20 +397,21 @@ void Call::checkStmt() {
 		}
 	}
 	else{
-		decl =  field->checkDeclId();
-		if ((decl == NULL) || (typeid(*decl) != typeid(FnDecl))){
+		if ((decl = field->getDecl()) == NULL)
+			decl = field->checkDeclId();
+		if ((decl == NULL) || !isa<FnDecl>(decl)){
 			ReportError::IdentifierNotDeclared(field, LookingForFunction);
 			decl = NULL; 
 		}
 		else
-			checkArgs(dynamic_cast<FnDecl*>(decl));
+			checkArgs(cast<FnDecl>(decl));
 	}
 	if (decl != NULL)
 		type = decl->getType(); // returnType
 }
 
 
-NewExpr::NewExpr(yyltype loc, NamedType *c) : Expr(loc) { 
+NewExpr::NewExpr(yyltype loc, NamedType *c) : Expr(NewExprKind, loc) { 
   Assert(c != NULL);
   (cType=c)->SetParent(this);
 }
@@ -374,14 +421,14 @@ void NewExpr::checkStmt() {
 	if (cType){
 		const char *name = cType->getTypeName();
 		if (name){
-			Decl *decl = Program::st->Lookup(name);
-			if ((decl == NULL) || (typeid(*decl) != typeid(ClassDecl)))
+			Decl *decl = cType->getDecl();
+			if ((decl == NULL) || !isa<ClassDecl>(decl))
 				ReportError::IdentifierNotDeclared(new Identifier(*cType->GetLocation(), name), LookingForClass);
 		}
 	}
 }
 
-NewArrayExpr::NewArrayExpr(yyltype loc, Expr *sz, Type *et) : Expr(loc) {
+NewArrayExpr::NewArrayExpr(yyltype loc, Expr *sz, Type *et) : Expr(NewArrayExprKind, loc) {
     Assert(sz != NULL && et != NULL);
     (size=sz)->SetParent(this); 
     (elemType=et)->SetParent(this);
@@ -392,14 +439,22 @@ const char *NewArrayExpr::getTypeName() {
 	if (elemType){
 		string delim = "[]";
 		string str = elemType->getTypeName() + delim;
-		return str.c_str();
+		return Intern(str.c_str());
 	}
 	else
 		return NULL;
 }
 
+void NewArrayExpr::getCheckChildren(std::vector<Node*> &children) {
+	children.push_back(size);
+}
+
+void NewArrayExpr::getChildren(std::vector<Node*> &children) {
+	children.push_back(size);
+	children.push_back(elemType);
+}
+
 void NewArrayExpr::checkStmt() {
-	size->checkStmt();
 	if (strcmp(size->getTypeName(), "int"))
 		ReportError::NewArraySizeNotInteger(size);
 	
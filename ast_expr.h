@@ -15,7 +15,7 @@
 
 #include "ast.h"
 #include "ast_stmt.h"
-#include "list.h"
+#include "nodelist.h"
 #include "ast_type.h"
 #include "ast_decl.h"
 #include <string>
@@ -29,11 +29,16 @@ class Expr : public Stmt
 	protected:
 		Type *type;
   public:
-    Expr(yyltype loc) : Stmt(loc) {}
-    Expr() : Stmt() {}
+    Expr(NodeKind k, yyltype loc) : Stmt(k, loc) {}
+    Expr(NodeKind k) : Stmt(k) {}
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstExprKind && n->GetKind() <= LastExprKind; }
 //TODO
 	virtual Type *getType() { return type; }
 	virtual const char *getTypeName() { return type->getTypeName();}
+	          // Returns the global declaration the type's name names, as
+	          // looking getTypeName up in the globals would, else NULL.
+	virtual Decl *getTypeDecl();
 };
 
 /* This node type is used for those places where an expression is optional.
@@ -42,57 +47,70 @@ class Expr : public Stmt
 class EmptyExpr : public Expr
 {
   public:
+    EmptyExpr() : Expr(EmptyExprKind) {}
+    static bool classof(const Node *n) { return n->GetKind() == EmptyExprKind; }
 };
 
 class IntConstant : public Expr 
 {
   protected:
     int value;
+    friend class AstImage;
   
   public:
     IntConstant(yyltype loc, int val);
+    static bool classof(const Node *n) { return n->GetKind() == IntConstantKind; }
 };
 
 class DoubleConstant : public Expr 
 {
   protected:
     double value;
+    friend class AstImage;
     
   public:
     DoubleConstant(yyltype loc, double val);
+    static bool classof(const Node *n) { return n->GetKind() == DoubleConstantKind; }
 };
 
 class BoolConstant : public Expr 
 {
   protected:
     bool value;
+    friend class AstImage;
     
   public:
     BoolConstant(yyltype loc, bool val);
+    static bool classof(const Node *n) { return n->GetKind() == BoolConstantKind; }
 };
 
 class StringConstant : public Expr 
 { 
   protected:
-    char *value;
+    const char *value;  // interned, quotes included
+    friend class AstImage;
     
   public:
     StringConstant(yyltype loc, const char *val);
+    static bool classof(const Node *n) { return n->GetKind() == StringConstantKind; }
 };
 
 class NullConstant: public Expr 
 {
   public: 
-    NullConstant(yyltype loc) : Expr(loc) {}
+    NullConstant(yyltype loc) : Expr(NullConstantKind, loc) {}
+    static bool classof(const Node *n) { return n->GetKind() == NullConstantKind; }
 };
 
 class Operator : public Node 
 {
   protected:
     char tokenString[4];
+    friend class AstImage;
     
   public:
     Operator(yyltype loc, const char *tok);
+    static bool classof(const Node *n) { return n->GetKind() == OperatorKind; }
     friend std::ostream& operator<<(std::ostream& out, Operator *o) { return out << o->tokenString; }
  };
  
@@ -101,17 +119,24 @@ class CompoundExpr : public Expr
   protected:
     Operator *op;
     Expr *left, *right; // left will be NULL if unary
+    friend class AstImage;
     
   public:
-    CompoundExpr(Expr *lhs, Operator *op, Expr *rhs); // for binary
-    CompoundExpr(Operator *op, Expr *rhs);             // for unary
+    CompoundExpr(NodeKind k, Expr *lhs, Operator *op, Expr *rhs); // for binary
+    CompoundExpr(NodeKind k, Operator *op, Expr *rhs);             // for unary
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstCompoundExprKind && n->GetKind() <= LastCompoundExprKind; }
+//TODO
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 };
 
 class ArithmeticExpr : public CompoundExpr 
 {
   public:
-    ArithmeticExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
-    ArithmeticExpr(Operator *op, Expr *rhs) : CompoundExpr(op,rhs) {}
+    ArithmeticExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(ArithmeticExprKind,lhs,op,rhs) {}
+    ArithmeticExpr(Operator *op, Expr *rhs) : CompoundExpr(ArithmeticExprKind,op,rhs) {}
+    static bool classof(const Node *n) { return n->GetKind() == ArithmeticExprKind; }
 //TODO
 	void checkStmt();
 	Type *getType() {return right->getType();}
@@ -121,7 +146,8 @@ class ArithmeticExpr : public CompoundExpr
 class RelationalExpr : public CompoundExpr 
 {
   public:
-    RelationalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
+    RelationalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(RelationalExprKind,lhs,op,rhs) {}
+    static bool classof(const Node *n) { return n->GetKind() == RelationalExprKind; }
 //TODO
 	void checkStmt();
 	Type *getType() {return Type::boolType;}
@@ -131,7 +157,8 @@ class RelationalExpr : public CompoundExpr
 class EqualityExpr : public CompoundExpr 
 {
   public:
-    EqualityExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
+    EqualityExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(EqualityExprKind,lhs,op,rhs) {}
+    static bool classof(const Node *n) { return n->GetKind() == EqualityExprKind; }
     const char *GetPrintNameForNode() { return "EqualityExpr"; }
 //TODO
 	void checkStmt();
@@ -142,8 +169,9 @@ class EqualityExpr : public CompoundExpr
 class LogicalExpr : public CompoundExpr 
 {
   public:
-    LogicalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
-    LogicalExpr(Operator *op, Expr *rhs) : CompoundExpr(op,rhs) {}
+    LogicalExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(LogicalExprKind,lhs,op,rhs) {}
+    LogicalExpr(Operator *op, Expr *rhs) : CompoundExpr(LogicalExprKind,op,rhs) {}
+    static bool classof(const Node *n) { return n->GetKind() == LogicalExprKind; }
     const char *GetPrintNameForNode() { return "LogicalExpr"; }
 //TODO
 	void checkStmt();
@@ -154,7 +182,8 @@ class LogicalExpr : public CompoundExpr
 class AssignExpr : public CompoundExpr 
 {
   public:
-    AssignExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(lhs,op,rhs) {}
+    AssignExpr(Expr *lhs, Operator *op, Expr *rhs) : CompoundExpr(AssignExprKind,lhs,op,rhs) {}
+    static bool classof(const Node *n) { return n->GetKind() == AssignExprKind; }
     const char *GetPrintNameForNode() { return "AssignExpr"; }
 //TODO
 	void checkStmt();
@@ -165,13 +194,16 @@ class AssignExpr : public CompoundExpr
 class LValue : public Expr 
 {
   public:
-    LValue(yyltype loc) : Expr(loc) {}
+    LValue(NodeKind k, yyltype loc) : Expr(k, loc) {}
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstLValueKind && n->GetKind() <= LastLValueKind; }
 };
 
 class This : public Expr 
 {
   public:
-    This(yyltype loc) : Expr(loc) {}
+    This(yyltype loc) : Expr(ThisKind, loc) {}
+    static bool classof(const Node *n) { return n->GetKind() == ThisKind; }
 //TODO
 	void checkStmt();
 };
@@ -180,11 +212,15 @@ class ArrayAccess : public LValue
 {
   protected:
     Expr *base, *subscript;
+    friend class AstImage;
     
   public:
     ArrayAccess(yyltype loc, Expr *base, Expr *subscript);
+    static bool classof(const Node *n) { return n->GetKind() == ArrayAccessKind; }
 //TODO
 	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 	Type *getType(); 
 	const char *getTypeName(); 
 };
@@ -200,11 +236,16 @@ class FieldAccess : public LValue
     Expr *base;	// will be NULL if no explicit base
     Identifier *field;
     Type *type;
+    friend class AstImage;
     
   public:
     FieldAccess(Expr *base, Identifier *field); //ok to pass NULL base
+    static bool classof(const Node *n) { return n->GetKind() == FieldAccessKind; }
 //TODO
 	void checkStmt();
+	int resolveNames();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 	Type *getType() { return type; }
 	const char *getTypeName() { return type->getTypeName();}
 	Identifier *getField() { return field; }
@@ -219,12 +260,17 @@ class Call : public Expr
   protected:
     Expr *base;	// will be NULL if no explicit base
     Identifier *field;
-    List<Expr*> *actuals;
+    NodeList<Expr*> *actuals;
+    friend class AstImage;
     
   public:
-    Call(yyltype loc, Expr *base, Identifier *field, List<Expr*> *args);
+    Call(yyltype loc, Expr *base, Identifier *field, NodeList<Expr*> *args);
+    static bool classof(const Node *n) { return n->GetKind() == CallKind; }
 //TODO
 	void checkStmt();
+	int resolveNames();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 	void checkArgs(FnDecl *fndecl);
 	Type *getType() { return type; }
 	const char *getTypeName() { return type->getTypeName();}
@@ -234,11 +280,14 @@ class NewExpr : public Expr
 {
   protected:
     NamedType *cType;
+    friend class AstImage;
     
   public:
     NewExpr(yyltype loc, NamedType *clsType);
+    static bool classof(const Node *n) { return n->GetKind() == NewExprKind; }
 //TODO
 	void checkStmt();
+	void getChildren(std::vector<Node*> &children) { children.push_back(cType); }
 	Type *getType() { return type; }
 	const char *getTypeName() { return type->getTypeName();}
 };
@@ -248,25 +297,32 @@ class NewArrayExpr : public Expr
   protected:
     Expr *size;
     Type *elemType;
+    friend class AstImage;
     
   public:
     NewArrayExpr(yyltype loc, Expr *sizeExpr, Type *elemType);
+    static bool classof(const Node *n) { return n->GetKind() == NewArrayExprKind; }
 //TODO
 	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 	Type *getType() { return elemType; }
 	const char *getTypeName();
+	Decl *getTypeDecl() { return NULL; } // an array names no declaration
 };
 
 class ReadIntegerExpr : public Expr
 {
   public:
-    ReadIntegerExpr(yyltype loc) : Expr(loc) {}
+    ReadIntegerExpr(yyltype loc) : Expr(ReadIntegerExprKind, loc) {}
+    static bool classof(const Node *n) { return n->GetKind() == ReadIntegerExprKind; }
 };
 
 class ReadLineExpr : public Expr
 {
   public:
-    ReadLineExpr(yyltype loc) : Expr (loc) {}
+    ReadLineExpr(yyltype loc) : Expr (ReadLineExprKind, loc) {}
+    static bool classof(const Node *n) { return n->GetKind() == ReadLineExprKind; }
 };
 
     
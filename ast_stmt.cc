@@ -7,20 +7,24 @@
 #include "ast_decl.h"
 #include "ast_expr.h"
 #include "errors.h"
-#include <typeinfo>
+#include "symtab.h"
+#include "compilation.h"
 
-//TODO
-Hashtable<Decl*> *Program::st  = new Hashtable<Decl*>;
-
-Program::Program(List<Decl*> *d) {
+Program::Program(NodeList<Decl*> *d) : Node(ProgramKind) {
     Assert(d != NULL);
     (decls=d)->SetParentAll(this);
+    st = new Hashtable<Decl*>;  // from the compilation's arena, like the tree
+}
+
+Hashtable<Decl*> *Program::Globals() {
+	Compilation *c = Compilation::Current();
+	return (c && c->program) ? c->program->st : NULL;
 }
 
 //TODO
-void Program::checkStmt() {
+void Program::getCheckChildren(std::vector<Node*> &children) {
 	for (int i = 0; i < decls->NumElements(); ++i)
-		decls->Nth(i)->checkStmt();
+		children.push_back(decls->Nth(i));
 }
 
 void Program::checkDeclErr() {
@@ -30,12 +34,19 @@ void Program::checkDeclErr() {
 			Decl *prev;
 			const char *name = cur->getId()->getName();
 			if (name){
-				if ((prev = Program::st->Lookup(name)) != NULL)
+				if ((prev = st->Lookup(name)) != NULL)
 					ReportError::DeclConflict(cur, prev);
 				else st->Enter(name, cur);
 			}
 		}
 
+		ClassDecl::BuildHierarchy(decls);
+
+		unsigned long before = Hashtable<Decl*>::NumLookups() + SymbolTable::NumLookups();
+		int numResolved = ResolveNames(this);
+		PrintDebug("stats", "Resolved %d names with %lu lookups", numResolved,
+			   Hashtable<Decl*>::NumLookups() + SymbolTable::NumLookups() - before);
+
 		for (int i = 0; i < decls->NumElements(); ++i)
 			decls->Nth(i)->checkDeclErr();
 	}
@@ -49,40 +60,60 @@ void Program::Check() {
      *      checking itself, which makes for a great use of inheritance
      *      and polymorphism in the node classes.
      */
-	this->checkStmt();
+	BuildScopes(this);
+	CheckTree(this);
 	this->checkDeclErr();
 }
 
-StmtBlock::StmtBlock(List<VarDecl*> *d, List<Stmt*> *s) {
+StmtBlock::StmtBlock(NodeList<VarDecl*> *d, NodeList<Stmt*> *s) : Stmt(StmtBlockKind) {
     Assert(d != NULL && s != NULL);
     (decls=d)->SetParentAll(this);
     (stmts=s)->SetParentAll(this);
-//TODO
-	st = new Hashtable<Decl*>;
 }
 
 //TODO
-void StmtBlock::checkStmt() {
+void StmtBlock::getCheckChildren(std::vector<Node*> &children) {
 	if (stmts){
 		for (int i = 0; i < stmts->NumElements(); ++i){
 			Stmt *stmt = stmts->Nth(i);
-			stmt->checkStmt();
+			children.push_back(stmt);
 		}
 	}
 }
 
+void StmtBlock::getChildren(std::vector<Node*> &children) {
+	for (int i = 0; i < decls->NumElements(); ++i)
+		children.push_back(decls->Nth(i));
+	for (int i = 0; i < stmts->NumElements(); ++i)
+		children.push_back(stmts->Nth(i));
+}
+
+bool StmtBlock::openScope(SymbolTable *symbols) {
+	if (decls->NumElements() == 0)
+		return false;
+	symbols->OpenScope();
+	for (int i = 0; i < decls->NumElements(); ++i){
+		VarDecl *cur = decls->Nth(i);
+		const char *name = cur->getId()->getName();
+		if (name && !symbols->LookupInScope(name))
+			symbols->Enter(name, cur);
+	}
+	return true;
+}
+
 void StmtBlock::checkDeclErr() {
-	if (decls){
+	if (decls && decls->NumElements() > 0){
+		Hashtable<Decl*> declared;	// only for finding conflicts
 		for (int i = 0; i < decls->NumElements(); ++i){
 			VarDecl *cur = decls->Nth(i);
 			Decl *prev;
 			const char *name = cur->getId()->getName();
 
 			if (name){
-				if ((prev = st->Lookup(name)) != NULL)
+				if ((prev = declared.Lookup(name)) != NULL)
 					ReportError::DeclConflict(cur, prev);
 				else{
-					st->Enter(name, cur);
+					declared.Enter(name, cur);
 					cur->checkDeclErr();
 				}
 			}
@@ -98,46 +129,51 @@ void StmtBlock::checkDeclErr() {
 }
 
 
-ConditionalStmt::ConditionalStmt(Expr *t, Stmt *b) { 
+ConditionalStmt::ConditionalStmt(NodeKind k, Expr *t, Stmt *b) : Stmt(k) { 
     Assert(t != NULL && b != NULL);
     (test=t)->SetParent(this); 
     (body=b)->SetParent(this);
 }
 
 //TODO
+void ConditionalStmt::getCheckChildren(std::vector<Node*> &children){
+	children.push_back(test);
+	children.push_back(body);
+}
+
 void ConditionalStmt::checkStmt(){
-	test->checkStmt();
 	if (strcmp(test->getTypeName(), "bool"))
 		ReportError::TestNotBoolean(test);
-
-	body->checkStmt();
 }
 
 void ConditionalStmt::checkDeclErr(){
 
 }
 
-ForStmt::ForStmt(Expr *i, Expr *t, Expr *s, Stmt *b): LoopStmt(t, b) { 
+ForStmt::ForStmt(Expr *i, Expr *t, Expr *s, Stmt *b): LoopStmt(ForStmtKind, t, b) { 
     Assert(i != NULL && t != NULL && s != NULL && b != NULL);
     (init=i)->SetParent(this);
     (step=s)->SetParent(this);
 }
 
 //TODO
-void ForStmt::checkStmt() {
+void ForStmt::getCheckChildren(std::vector<Node*> &children) {
 	if (init)
-		init->checkStmt();
+		children.push_back(init);
 	if (step)
-		step->checkStmt();
+		children.push_back(step);
   	
-	ConditionalStmt::checkStmt();
+	ConditionalStmt::getCheckChildren(children);
 }
 
-void WhileStmt::checkStmt() {
-	ConditionalStmt::checkStmt();
+void ForStmt::getChildren(std::vector<Node*> &children) {
+	children.push_back(init);
+	children.push_back(test);
+	children.push_back(step);
+	children.push_back(body);
 }
 
-IfStmt::IfStmt(Expr *t, Stmt *tb, Stmt *eb): ConditionalStmt(t, tb) { 
+IfStmt::IfStmt(Expr *t, Stmt *tb, Stmt *eb): ConditionalStmt(IfStmtKind, t, tb) { 
     Assert(t != NULL && tb != NULL); // else can be NULL
     elseBody = eb;
     if (elseBody) elseBody->SetParent(this);
@@ -150,56 +186,44 @@ void IfStmt::checkDeclErr() {
 		elseBody->checkDeclErr();
 }
 
-void IfStmt::checkStmt() {
-	ConditionalStmt::checkStmt();
+void IfStmt::getCheckChildren(std::vector<Node*> &children) {
+	ConditionalStmt::getCheckChildren(children);
 	if (elseBody)
-		elseBody->checkStmt();
+		children.push_back(elseBody);
 }
 
 void BreakStmt::checkStmt() {
-	Node *parent = this->GetParent();
-	while (parent){
-		if ((typeid(*parent) == typeid(WhileStmt)) ||
-			(typeid(*parent) == typeid(ForStmt)))
-			return;
-	
-	parent = parent->GetParent();
-	}
-	
-	ReportError::BreakOutsideLoop(this);
+	if (scope->loop == NULL)
+		ReportError::BreakOutsideLoop(this);
 }
 
 
-ReturnStmt::ReturnStmt(yyltype loc, Expr *e) : Stmt(loc) { 
+ReturnStmt::ReturnStmt(yyltype loc, Expr *e) : Stmt(ReturnStmtKind, loc) { 
     Assert(e != NULL);
     (expr=e)->SetParent(this);
 }
 
 //TODO
 
+void ReturnStmt::getCheckChildren(std::vector<Node*> &children) {
+	if (expr)
+		children.push_back(expr);
+}
+
 void ReturnStmt::checkStmt() {
-	const char *correctLoc;
-	Node *parent = this->GetParent();
-	
-	while (parent){
-		if (typeid(*parent) == typeid(FnDecl))
-			correctLoc = dynamic_cast<FnDecl*>(parent)->getTypeName();
-
-		parent = parent->GetParent();
-	}
+	const char *correctLoc = scope->fn->getTypeName();
 	if (expr){
-		expr->checkStmt();
 		const char *curType = expr->getTypeName();
 
 		if (curType && correctLoc){
-			Decl *gd = Program::st->Lookup(curType);
-          		Decl *cd = Program::st->Lookup(correctLoc);
+			Decl *gd = expr->getTypeDecl();
+          		Decl *cd = scope->fn->getType()->getDecl();
 
 			if (gd && cd){
 				if (!strcmp(curType, correctLoc))
 					return;
-				else if (typeid(*gd) == typeid(ClassDecl)){
-					ClassDecl *gClsd = dynamic_cast<ClassDecl*>(gd);
+				else if (isa<ClassDecl>(gd)){
+					ClassDecl *gClsd = cast<ClassDecl>(gd);
 
 					if (gClsd->IsCompatibleWith(cd))
 					return;
@@ -217,18 +241,24 @@ void ReturnStmt::checkStmt() {
 		ReportError::ReturnMismatch(this, new Type("void"), new Type(correctLoc));
 }
 
-PrintStmt::PrintStmt(List<Expr*> *a) {    
+PrintStmt::PrintStmt(NodeList<Expr*> *a) : Stmt(PrintStmtKind) {    
     Assert(a != NULL);
     (args=a)->SetParentAll(this);
 }
 
 //TODO
 
+void PrintStmt::getCheckChildren(std::vector<Node*> &children) {
+	if (args){
+		for (int i = 0; i < args->NumElements(); ++i)
+			children.push_back(args->Nth(i));
+	}
+}
+
 void PrintStmt::checkStmt() {
 	if (args){
 		for (int i = 0; i < args->NumElements(); ++i){
 			Expr *expr = args->Nth(i);
-			expr->checkStmt();
 			const char *typeName = expr->getTypeName();
 		if (typeName && strcmp(typeName, "string") && strcmp(typeName, "int") && strcmp(typeName, "bool"))
 			ReportError::PrintArgMismatch(expr, (i+1), new Type(typeName));
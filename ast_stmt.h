@@ -13,7 +13,7 @@
 #ifndef _H_ast_stmt
 #define _H_ast_stmt
 
-#include "list.h"
+#include "nodelist.h"
 #include "ast.h"
 #include "hashtable.h"
 
@@ -24,38 +24,48 @@ class Expr;
 class Program : public Node
 {
   protected:
-     List<Decl*> *decls;
+     NodeList<Decl*> *decls;
+     Hashtable<Decl*> *st;  // the global declarations, see checkDeclErr
+     friend class AstImage;
      
   public:
-     Program(List<Decl*> *declList);
+     Program(NodeList<Decl*> *declList);
+     static bool classof(const Node *n) { return n->GetKind() == ProgramKind; }
+     NodeList<Decl*> *GetDecls() { return decls; }
      void Check();
 //TODO
-	static Hashtable<Decl*> *st; //Global ST
+	          // Returns the global declarations of the program the
+	          // calling thread's compilation holds, or NULL if none.
+	static Hashtable<Decl*> *Globals();
 	void checkDeclErr();
-	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 };
 
 class Stmt : public Node
 {
   public:
-     Stmt() : Node() {}
-     Stmt(yyltype loc) : Node(loc) {}
+     Stmt(NodeKind k) : Node(k) {}
+     Stmt(NodeKind k, yyltype loc) : Node(k, loc) {}
+     static bool classof(const Node *n)
+        { return n->GetKind() >= FirstStmtKind && n->GetKind() <= LastStmtKind; }
 };
 
 class StmtBlock : public Stmt 
 {
   protected:
-    List<VarDecl*> *decls;
-    List<Stmt*> *stmts;
-//TODO
-	Hashtable<Decl*> *st;
+    NodeList<VarDecl*> *decls;
+    NodeList<Stmt*> *stmts;
+    friend class AstImage;
     
   public:
-    StmtBlock(List<VarDecl*> *variableDeclarations, List<Stmt*> *statements);
+    StmtBlock(NodeList<VarDecl*> *variableDeclarations, NodeList<Stmt*> *statements);
+    static bool classof(const Node *n) { return n->GetKind() == StmtBlockKind; }
 //TODO
-	Hashtable<Decl*> *getST() { return st; }
+	bool openScope(SymbolTable *symbols);
 	void checkDeclErr();
-	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 };
 
   
@@ -64,59 +74,73 @@ class ConditionalStmt : public Stmt
   protected:
     Expr *test;
     Stmt *body;
+    friend class AstImage;
   
   public:
-    ConditionalStmt(Expr *testExpr, Stmt *body);
+    ConditionalStmt(NodeKind k, Expr *testExpr, Stmt *body);
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstConditionalStmtKind && n->GetKind() <= LastConditionalStmtKind; }
 //TODO
 	void checkDeclErr();
 	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 	
 };
 
 class LoopStmt : public ConditionalStmt 
 {
   public:
-    LoopStmt(Expr *testExpr, Stmt *body)
-            : ConditionalStmt(testExpr, body) {}
+    LoopStmt(NodeKind k, Expr *testExpr, Stmt *body)
+            : ConditionalStmt(k, testExpr, body) {}
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstLoopStmtKind && n->GetKind() <= LastLoopStmtKind; }
 };
 
 class ForStmt : public LoopStmt 
 {
   protected:
     Expr *init, *step;
+    friend class AstImage;
   
   public:
     ForStmt(Expr *init, Expr *test, Expr *step, Stmt *body);
+    static bool classof(const Node *n) { return n->GetKind() == ForStmtKind; }
 //TODO
 	//void checkDeclErr();
-	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children);
 };
 
 class WhileStmt : public LoopStmt 
 {
   public:
-    WhileStmt(Expr *test, Stmt *body) : LoopStmt(test, body) {}
+    WhileStmt(Expr *test, Stmt *body) : LoopStmt(WhileStmtKind, test, body) {}
+    static bool classof(const Node *n) { return n->GetKind() == WhileStmtKind; }
 //TODO
 	//void checkDeclErr();
-	void checkStmt();
 };
 
 class IfStmt : public ConditionalStmt 
 {
   protected:
     Stmt *elseBody;
+    friend class AstImage;
   
   public:
     IfStmt(Expr *test, Stmt *thenBody, Stmt *elseBody);
+    static bool classof(const Node *n) { return n->GetKind() == IfStmtKind; }
 //TODO
 	void checkDeclErr();
-	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 };
 
 class BreakStmt : public Stmt 
 {
   public:
-    BreakStmt(yyltype loc) : Stmt(loc) {}
+    BreakStmt(yyltype loc) : Stmt(BreakStmtKind, loc) {}
+    static bool classof(const Node *n) { return n->GetKind() == BreakStmtKind; }
 //TODO
 	//void checkDeclErr();
 	void checkStmt();
@@ -126,24 +150,32 @@ class ReturnStmt : public Stmt
 {
   protected:
     Expr *expr;
+    friend class AstImage;
   
   public:
     ReturnStmt(yyltype loc, Expr *expr);
+    static bool classof(const Node *n) { return n->GetKind() == ReturnStmtKind; }
 //TODO
 	//void checkDeclErr();
 	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 };
 
 class PrintStmt : public Stmt
 {
   protected:
-    List<Expr*> *args;
+    NodeList<Expr*> *args;
+    friend class AstImage;
     
   public:
-    PrintStmt(List<Expr*> *arguments);
+    PrintStmt(NodeList<Expr*> *arguments);
+    static bool classof(const Node *n) { return n->GetKind() == PrintStmtKind; }
 //TODO
 	//void checkDeclErr();
 	void checkStmt();
+	void getCheckChildren(std::vector<Node*> &children);
+	void getChildren(std::vector<Node*> &children) { getCheckChildren(children); }
 };
 
 
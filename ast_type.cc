@@ -6,8 +6,8 @@
 #include "ast_decl.h"
 #include "ast_stmt.h"
 #include "errors.h"
+#include "intern.h"
 #include <string.h>
-#include <typeinfo>
  
 /* Class constants
  * ---------------
@@ -25,37 +25,55 @@ Type *Type::nullType   = new Type("null");
 Type *Type::stringType = new Type("string");
 Type *Type::errorType  = new Type("error"); 
 
-Type::Type(const char *n) {
+Type::Type(const char *n) : Node(TypeKind) {
     Assert(n);
-    typeName = strdup(n);
+    typeName = Intern(n);
 }
 	
-NamedType::NamedType(Identifier *i) : Type(*i->GetLocation()) {
+NamedType::NamedType(Identifier *i) : Type(NamedTypeKind, *i->GetLocation()) {
     Assert(i != NULL);
     (id=i)->SetParent(this);
 }
 
 //TODO
 bool NamedType::hasSameType(Type *nt) {
-	if (typeid(*nt) == typeid(NamedType))
-		return !strcmp(this->getTypeName(), nt->getTypeName());
+	if (isa<NamedType>(nt))
+		return this->getTypeName() == nt->getTypeName();
 
 	return false;
 }
 
 
+/* Function: getDecl
+ * ------------------
+ * The name is normally resolved already, but a type made up during the
+ * check (the type of "this", say) was not there to be, so a name found
+ * unresolved is looked up now, and the answer kept.
+ */
+Decl *NamedType::getDecl() {
+	if (id == NULL)
+		return NULL;
+	if (id->getDecl() == NULL)
+		resolveNames();
+	return id->getDecl();
+}
+
+int NamedType::resolveNames() {
+	Hashtable<Decl*> *globals = Program::Globals();
+	id->setDecl(globals ? globals->Lookup(id->getName()) : NULL);
+	return id->getDecl() != NULL;
+}
+
 void NamedType::checkTypeErr() {
-	const char *name = id->getName();
-	Decl *decl = Program::st->Lookup(name);
+	Decl *decl = getDecl();
 	if ((decl == NULL) || 
-		(((typeid(*decl) != typeid(ClassDecl))) && 
-			((typeid(*decl) != typeid(InterfaceDecl))))){
+		(!isa<ClassDecl>(decl) && !isa<InterfaceDecl>(decl))){
 		ReportError::IdentifierNotDeclared(id, LookingForType);
 		id = NULL;
 	}
 }
 
-ArrayType::ArrayType(yyltype loc, Type *et) : Type(loc) {
+ArrayType::ArrayType(yyltype loc, Type *et) : Type(ArrayTypeKind, loc) {
     Assert(et != NULL);
     (elemType=et)->SetParent(this);
 }
@@ -65,7 +83,7 @@ const char *ArrayType::getTypeName() {
 	if (elemType){
 		string delim = "[]";
 		string str = elemType->getTypeName() + delim;
-		return str.c_str();
+		return Intern(str.c_str());
 	}
 	else return NULL;
 }
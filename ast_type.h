@@ -22,14 +22,17 @@
 class Type : public Node 
 {
   protected:
-    char *typeName;
+    const char *typeName; // interned
+    friend class AstImage;
 
   public :
     static Type *intType, *doubleType, *boolType, *voidType,
                 *nullType, *stringType, *errorType;
 
-    Type(yyltype loc) : Node(loc) {}
+    Type(NodeKind k, yyltype loc) : Node(k, loc) {}
     Type(const char *str);
+    static bool classof(const Node *n)
+        { return n->GetKind() >= FirstTypeKind && n->GetKind() <= LastTypeKind; }
     
     virtual void PrintToStream(std::ostream& out) { out << typeName; }
     friend std::ostream& operator<<(std::ostream& out, Type *t) { t->PrintToStream(out); return out; }
@@ -37,6 +40,8 @@ class Type : public Node
 //TODO
 	virtual Type *getType() { return this; }
 	virtual const char *getTypeName() { return typeName; }
+	          // Returns the global declaration a named type names, else NULL.
+	virtual Decl *getDecl() { return NULL; }
 	bool hasSameType(Type *t) { return this == t;}
 	virtual void checkTypeErr() {}
 };
@@ -45,26 +50,33 @@ class NamedType : public Type
 {
   protected:
     Identifier *id;
+    friend class AstImage;
     
   public:
     NamedType(Identifier *i);
+    static bool classof(const Node *n) { return n->GetKind() == NamedTypeKind; }
     
     void PrintToStream(std::ostream& out) { out << id; }
 //TODO
 	Identifier *getId() { return id; }
 	Type *getType() { return this; }
 	const char *getTypeName() { return id->getName(); }
+	Decl *getDecl();
 	bool hasSameType(Type *nt);
 	void checkTypeErr();
+	int resolveNames();
+	void getChildren(std::vector<Node*> &children) { if (id) children.push_back(id); }
 };
 
 class ArrayType : public Type 
 {
   protected:
     Type *elemType;
+    friend class AstImage;
 
   public:
     ArrayType(yyltype loc, Type *elemType);
+    static bool classof(const Node *n) { return n->GetKind() == ArrayTypeKind; }
     
     void PrintToStream(std::ostream& out) { out << elemType << "[]"; }
 //TODO
@@ -72,6 +84,7 @@ class ArrayType : public Type
 	const char *getTypeName();
 	bool hasSameType(Type *at);
 	void checkTypeErr();
+	void getChildren(std::vector<Node*> &children) { children.push_back(elemType); }
 };
 
  
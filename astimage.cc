@@ -0,0 +1,658 @@
+/* File: astimage.cc
+ * -----------------
+ * Implementation of AstImage, writing and reading tree images.
+ */
+
+#include "astimage.h"
+#include "ast.h"
+#include "ast_decl.h"
+#include "ast_expr.h"
+#include "ast_stmt.h"
+#include "ast_type.h"
+#include "compilation.h"
+#include "intern.h"
+#include "utility.h"
+#include <string.h>
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// ImageVersion must change whenever NodeKind or the fields written for
+// any kind of node do, so that older images are refused.
+static const uint32_t ImageMagic = 0x54534144;  // "DAST"
+static const uint32_t ImageVersion = 1;
+
+enum { MagicWord, VersionWord, LengthWord, SourceLengthWord, RootWord, HeaderWords };
+
+// Words needed for n bytes.
+static inline uint32_t WordsFor(size_t n) { return (n + 3) / 4; }
+
+
+void AstImage::Write(Compilation *c, const char *path) {
+    Assert(c->program != NULL);
+    AstImage out(c);
+    out.words.resize(HeaderWords + WordsFor(c->sourceLength + 2), 0);
+    memcpy(&out.words[HeaderWords], c->sourceText, c->sourceLength);
+    uint32_t root = out.PutTree(c->program);
+    out.words[MagicWord] = ImageMagic;
+    out.words[VersionWord] = ImageVersion;
+    out.words[LengthWord] = out.words.size();
+    out.words[SourceLengthWord] = c->sourceLength;
+    out.words[RootWord] = root;
+
+    FILE *fp = fopen(path, "wb");
+    if (fp == NULL ||
+        fwrite(&out.words[0], sizeof(uint32_t), out.words.size(), fp) != out.words.size() ||
+        fclose(fp) != 0)
+        Failure("Cannot write tree image %s", path);
+    PrintDebug("ast", "Wrote %lu words to %s", (unsigned long)out.words.size(), path);
+}
+
+/* Function: Begin()
+ * -----------------
+ * Starts the record for n, once the records of its children are written,
+ * and returns where it is.
+ */
+uint32_t AstImage::Begin(Node *n) {
+    uint32_t at = words.size();
+    words.push_back(n->GetKind());
+    words.push_back(n->location.first ? n->location.first - compilation->sourceBase + 1 : 0);
+    words.push_back(n->location.last ? n->location.last - compilation->sourceBase + 1 : 0);
+    return at;
+}
+
+void AstImage::PutRef(uint32_t at, uint32_t target) {
+    words.push_back(target ? at - target : 0);
+}
+
+/* Function: PutTree()
+ * -------------------
+ * Writes the records for root and everything under it, children first,
+ * and returns where the record for root is. Trees can be nested far
+ * deeper than the C stack allows recursing, so the nodes still to be
+ * written are kept on toWrite instead, and where the records of
+ * finished ones are on written, in order, until their parent takes
+ * them. PutNode is first tried on the node on top with expanding set,
+ * when Ref pushes its children rather than handing them over; if there
+ * were any, what it wrote is dropped, and it is tried again once they
+ * are done. Only leaves have strings, so no string record is dropped.
+ */
+uint32_t AstImage::PutTree(Node *root) {
+    toWrite.push_back((PendingNode){root, 0, false});
+    while (!toWrite.empty()) {
+        PendingNode top = toWrite.back();
+        if (top.node == NULL) {
+            toWrite.pop_back();
+            written.push_back(0);
+            continue;
+        }
+        size_t waiting = toWrite.size(), start = words.size();
+        expanding = !top.expanded;
+        nextKid = top.firstKid;
+        uint32_t at = PutNode(top.node);
+        if (toWrite.size() > waiting) {
+            words.resize(start);
+            std::reverse(toWrite.begin() + waiting, toWrite.end());
+            toWrite[waiting - 1].expanded = true;
+            toWrite[waiting - 1].firstKid = written.size();
+            continue;
+        }
+        toWrite.pop_back();
+        if (top.expanded)
+            written.resize(top.firstKid);
+        written.push_back(at);
+    }
+    return written.back();
+}
+
+/* Function: Ref()
+ * ---------------
+ * Returns where the record for the next child of the node being written
+ * is (0 for NULL), or pushes it on toWrite while expanding.
+ */
+uint32_t AstImage::Ref(Node *child) {
+    if (expanding) {
+        toWrite.push_back((PendingNode){child, 0, false});
+        return 0;
+    }
+    return written[nextKid++];
+}
+
+uint32_t AstImage::PutString(const char *s) {
+    std::unordered_map<const char *, uint32_t>::iterator it = strings.find(s);
+    if (it != strings.end())
+        return it->second;
+    uint32_t at = words.size();
+    size_t len = strlen(s) + 1;
+    words.resize(at + WordsFor(len), 0);
+    memcpy(&words[at], s, len);
+    strings[s] = at;
+    return at;
+}
+
+template<class Element> uint32_t AstImage::PutList(NodeList<Element> *list) {
+    std::vector<uint32_t> elems(list->NumElements());
+    for (int i = 0; i < list->NumElements(); i++)
+        elems[i] = Ref(list->Nth(i));
+    uint32_t at = words.size();
+    words.push_back(elems.size());
+    for (int i = 0; i < elems.size(); i++)
+        PutRef(at, elems[i]);
+    return at;
+}
+
+/* Function: PutNode()
+ * -------------------
+ * Writes the record for n and returns where it is. The fields of each
+ * kind of node follow its kind and location in the order its
+ * constructor takes them.
+ */
+uint32_t AstImage::PutNode(Node *n) {
+    uint32_t at = 0, a, b, c, d;
+    switch (n->GetKind()) {
+      case IdentifierKind:
+        a = PutString(cast<Identifier>(n)->name);
+        at = Begin(n); PutRef(at, a);
+        break;
+      case OperatorKind:
+        a = PutString(Intern(cast<Operator>(n)->tokenString));
+        at = Begin(n); PutRef(at, a);
+        break;
+      case ProgramKind:
+        a = PutList(cast<Program>(n)->decls);
+        at = Begin(n); PutRef(at, a);
+        break;
+
+      case VarDeclKind: {
+        VarDecl *vd = cast<VarDecl>(n);
+        a = Ref(vd->id); b = Ref(vd->type);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case ClassDeclKind: {
+        ClassDecl *cd = cast<ClassDecl>(n);
+        a = Ref(cd->id); b = Ref(cd->extends);
+        c = PutList(cd->implements); d = PutList(cd->members);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c); PutRef(at, d);
+        break;
+      }
+      case InterfaceDeclKind: {
+        InterfaceDecl *id = cast<InterfaceDecl>(n);
+        a = Ref(id->id); b = PutList(id->members);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case FnDeclKind: {
+        FnDecl *fd = cast<FnDecl>(n);
+        a = Ref(fd->id); b = Ref(fd->returnType);
+        c = PutList(fd->formals); d = Ref(fd->body);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c); PutRef(at, d);
+        break;
+      }
+
+      case TypeKind:
+        a = PutString(cast<Type>(n)->typeName);
+        at = Begin(n); PutRef(at, a);
+        break;
+      case NamedTypeKind:
+        a = Ref(cast<NamedType>(n)->id);
+        at = Begin(n); PutRef(at, a);
+        break;
+      case ArrayTypeKind:
+        a = Ref(cast<ArrayType>(n)->elemType);
+        at = Begin(n); PutRef(at, a);
+        break;
+
+      case StmtBlockKind: {
+        StmtBlock *sb = cast<StmtBlock>(n);
+        a = PutList(sb->decls); b = PutList(sb->stmts);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case IfStmtKind: {
+        IfStmt *is = cast<IfStmt>(n);
+        a = Ref(is->test); b = Ref(is->body); c = Ref(is->elseBody);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c);
+        break;
+      }
+      case ForStmtKind: {
+        ForStmt *fs = cast<ForStmt>(n);
+        a = Ref(fs->init); b = Ref(fs->test);
+        c = Ref(fs->step); d = Ref(fs->body);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c); PutRef(at, d);
+        break;
+      }
+      case WhileStmtKind: {
+        WhileStmt *ws = cast<WhileStmt>(n);
+        a = Ref(ws->test); b = Ref(ws->body);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case ReturnStmtKind:
+        a = Ref(cast<ReturnStmt>(n)->expr);
+        at = Begin(n); PutRef(at, a);
+        break;
+      case PrintStmtKind:
+        a = PutList(cast<PrintStmt>(n)->args);
+        at = Begin(n); PutRef(at, a);
+        break;
+
+      case IntConstantKind:
+        at = Begin(n);
+        words.push_back(cast<IntConstant>(n)->value);
+        break;
+      case DoubleConstantKind: {
+        double value = cast<DoubleConstant>(n)->value;
+        at = Begin(n);
+        words.resize(at + 3 + WordsFor(sizeof(value)));
+        memcpy(&words[at + 3], &value, sizeof(value));
+        break;
+      }
+      case BoolConstantKind:
+        at = Begin(n);
+        words.push_back(cast<BoolConstant>(n)->value);
+        break;
+      case StringConstantKind:
+        a = PutString(cast<StringConstant>(n)->value);
+        at = Begin(n); PutRef(at, a);
+        break;
+
+      case ArithmeticExprKind: case RelationalExprKind: case EqualityExprKind:
+      case LogicalExprKind: case AssignExprKind: {
+        CompoundExpr *ce = cast<CompoundExpr>(n);
+        a = Ref(ce->left); b = Ref(ce->op); c = Ref(ce->right);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c);
+        break;
+      }
+      case ArrayAccessKind: {
+        ArrayAccess *aa = cast<ArrayAccess>(n);
+        a = Ref(aa->base); b = Ref(aa->subscript);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case FieldAccessKind: {
+        FieldAccess *fa = cast<FieldAccess>(n);
+        a = Ref(fa->base); b = Ref(fa->field);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+      case CallKind: {
+        Call *call = cast<Call>(n);
+        a = Ref(call->base); b = Ref(call->field); c = PutList(call->actuals);
+        at = Begin(n); PutRef(at, a); PutRef(at, b); PutRef(at, c);
+        break;
+      }
+      case NewExprKind:
+        a = Ref(cast<NewExpr>(n)->cType);
+        at = Begin(n); PutRef(at, a);
+        break;
+      case NewArrayExprKind: {
+        NewArrayExpr *na = cast<NewArrayExpr>(n);
+        a = Ref(na->size); b = Ref(na->elemType);
+        at = Begin(n); PutRef(at, a); PutRef(at, b);
+        break;
+      }
+
+      case BreakStmtKind: case EmptyExprKind: case NullConstantKind:
+      case ThisKind: case ReadIntegerExprKind: case ReadLineExprKind:
+        at = Begin(n);
+        break;
+
+      default:
+        Failure("Cannot write a node of kind %d to a tree image", n->GetKind());
+    }
+    return at;
+}
+
+
+void AstImage::Map(Compilation *c, const char *path) {
+    int fd = open(path, O_RDONLY);
+    struct stat sb;
+    if (fd < 0 || fstat(fd, &sb) != 0)
+        Failure("Cannot open tree image %s", path);
+
+    size_t len = sb.st_size;
+    const uint32_t *image = NULL;
+    if (len >= HeaderWords * sizeof(uint32_t))
+        image = (const uint32_t *)mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (image == NULL || image == MAP_FAILED)
+        Failure("Cannot map tree image %s", path);
+    if (image[MagicWord] != ImageMagic || image[VersionWord] != ImageVersion ||
+        (size_t)image[LengthWord] * sizeof(uint32_t) != len ||
+        HeaderWords + WordsFor(image[SourceLengthWord] + 2) > image[RootWord] ||
+        image[RootWord] + 4 > image[LengthWord])
+        Failure("%s is not a tree image from this compiler", path);
+
+    c->astImage = image;
+    c->astImageLength = len;
+    c->sourceText = (char *)(image + HeaderWords);
+    c->sourceLength = image[SourceLengthWord];
+}
+
+Program *AstImage::Read(Compilation *c) {
+    AstImage in(c);
+    in.image = c->astImage;
+    in.imageLength = in.image[LengthWord];
+    return cast<Program>(in.GetTree(in.image[RootWord]));
+}
+
+/* Function: FieldsOf()
+ * --------------------
+ * What follows the kind and location in the record for a node of the
+ * given kind, one letter a word: 'n' a node, 'l' a list of nodes, 's' a
+ * string and '-' plain data. NULL for a kind never written.
+ */
+static const char *FieldsOf(uint32_t kind) {
+    switch (kind) {
+      case IdentifierKind: case OperatorKind: case TypeKind:
+      case StringConstantKind:
+        return "s";
+      case ProgramKind: case PrintStmtKind:
+        return "l";
+      case VarDeclKind: case WhileStmtKind: case ArrayAccessKind:
+      case FieldAccessKind: case NewArrayExprKind:
+        return "nn";
+      case ClassDeclKind:
+        return "nnll";
+      case InterfaceDeclKind:
+        return "nl";
+      case FnDeclKind:
+        return "nnln";
+      case NamedTypeKind: case ArrayTypeKind: case ReturnStmtKind:
+      case NewExprKind:
+        return "n";
+      case StmtBlockKind:
+        return "ll";
+      case IfStmtKind:
+      case ArithmeticExprKind: case RelationalExprKind: case EqualityExprKind:
+      case LogicalExprKind: case AssignExprKind:
+        return "nnn";
+      case ForStmtKind:
+        return "nnnn";
+      case CallKind:
+        return "nnl";
+      case IntConstantKind: case BoolConstantKind:
+        return "-";
+      case DoubleConstantKind:
+        return "--";
+      case BreakStmtKind: case EmptyExprKind: case NullConstantKind:
+      case ThisKind: case ReadIntegerExprKind: case ReadLineExprKind:
+        return "";
+      default:
+        return NULL;
+    }
+}
+
+/* Function: GetTree()
+ * -------------------
+ * Builds the node whose record is at root and everything under it. As
+ * in PutTree, the records still to be built are kept on toRead rather
+ * than on the C stack, and finished nodes on built until their parent
+ * takes them: Need pushes the children of the record on top, and it is
+ * built once they are.
+ */
+Node *AstImage::GetTree(uint32_t root) {
+    toRead.push_back((PendingRecord){root, 0, false});
+    while (!toRead.empty()) {
+        PendingRecord top = toRead.back();
+        if (top.record == 0) {
+            toRead.pop_back();
+            built.push_back(NULL);
+            continue;
+        }
+        size_t waiting = toRead.size();
+        if (!top.expanded) {
+            Need(top.record);
+            if (toRead.size() > waiting) {
+                toRead[waiting - 1].expanded = true;
+                toRead[waiting - 1].firstKid = built.size();
+                continue;
+            }
+        }
+        toRead.pop_back();
+        size_t firstKid = top.expanded ? top.firstKid : built.size();
+        Node *n = GetNode(top.record, firstKid);
+        built.resize(firstKid);
+        built.push_back(n);
+    }
+    return built.back();
+}
+
+/* Function: Need()
+ * ----------------
+ * Pushes on toRead each node that the node record at refers to, directly
+ * or through a list, the first last so that it is built first, checking
+ * on the way that the record fits in the image and that its locations
+ * are in the source (an offset past the end would be taken for one in
+ * whatever compilation has the numbers after it).
+ */
+void AstImage::Need(uint32_t at) {
+    const char *fields = (at + 3 <= imageLength) ? FieldsOf(image[at]) : NULL;
+    int numFields = fields ? strlen(fields) : 0;
+    if (fields == NULL || at + 3 + numFields > imageLength)
+        Failure("Bad node in tree image at word %u", at);
+    if (image[at + 1] > image[SourceLengthWord] + 1 || image[at + 2] > image[SourceLengthWord] + 1)
+        Failure("Bad location in tree image at word %u", at);
+    for (int i = numFields - 1; i >= 0; i--) {      // last on top
+        uint32_t ref = image[at + 3 + i];
+        if (fields[i] == 'n') {
+            toRead.push_back((PendingRecord){ref ? Target(at, ref) : 0, 0, false});
+        } else if (fields[i] == 'l') {
+            uint32_t l = Target(at, ref);
+            if (image[l] > imageLength - l - 1)
+                Failure("Bad list in tree image at word %u", l);
+            for (uint32_t j = image[l]; j > 0; j--) {
+                ref = image[l + j];
+                toRead.push_back((PendingRecord){ref ? Target(l, ref) : 0, 0, false});
+            }
+        }
+    }
+}
+
+/* Function: Target()
+ * ------------------
+ * Returns where the record that the record at refers to with ref is,
+ * making sure it is inside the image and before the referring record.
+ */
+uint32_t AstImage::Target(uint32_t at, uint32_t ref) {
+    if (ref == 0 || ref > at - HeaderWords)
+        Failure("Bad reference in tree image at word %u", at);
+    return at - ref;
+}
+
+SourceLoc AstImage::Loc(uint32_t offset) {
+    return offset ? compilation->sourceBase + offset - 1 : 0;
+}
+
+template<class T> T *AstImage::Get(int field) {
+    Node *n = built[kid[field]];
+    return n ? cast<T>(n) : NULL;
+}
+
+const char *AstImage::GetString(uint32_t at, uint32_t ref) {
+    uint32_t s = Target(at, ref);
+    const char *str = (const char *)(image + s);
+    if (memchr(str, '\0', (imageLength - s) * sizeof(uint32_t)) == NULL)
+        Failure("Bad string in tree image at word %u", s);
+    return Intern(str);
+}
+
+template<class T> NodeList<T*> *AstImage::GetList(int field) {
+    SmallList<T*> list;
+    for (uint32_t i = 0; i < kidCount[field]; i++) {
+        Node *n = built[kid[field] + i];
+        list.Append(n ? cast<T>(n) : NULL);
+    }
+    return list.Freeze();
+}
+
+/* Function: GetNode()
+ * -------------------
+ * Builds the node whose record is at the given word, the same way the
+ * parser would have, from the nodes under it, which GetTree has left on
+ * built from firstKid on.
+ */
+Node *AstImage::GetNode(uint32_t at, size_t firstKid) {
+    const uint32_t *r = image + at;
+    const char *fields = FieldsOf(r[0]);
+    for (int i = 0; fields != NULL && fields[i] != '\0'; i++) {
+        kid[i] = firstKid;
+        kidCount[i] = (fields[i] == 'n') ? 1 : (fields[i] == 'l') ? image[Target(at, r[3 + i])] : 0;
+        firstKid += kidCount[i];
+    }
+    yyltype loc;
+    loc.first = Loc(r[1]);
+    loc.last = Loc(r[2]);
+
+    Node *n;
+    switch (r[0]) {
+      case IdentifierKind:
+        n = new Identifier(loc, GetString(at, r[3]));
+        break;
+      case OperatorKind:
+        n = new Operator(loc, GetString(at, r[3]));
+        break;
+      case ProgramKind:
+        n = new Program(GetList<Decl>(0));
+        break;
+
+      case VarDeclKind:
+        n = new VarDecl(Get<Identifier>(0), Get<Type>(1));
+        break;
+      case ClassDeclKind:
+        n = new ClassDecl(Get<Identifier>(0), Get<NamedType>(1),
+                          GetList<NamedType>(2), GetList<Decl>(3));
+        break;
+      case InterfaceDeclKind:
+        n = new InterfaceDecl(Get<Identifier>(0), GetList<Decl>(1));
+        break;
+      case FnDeclKind: {
+        FnDecl *fn = new FnDecl(Get<Identifier>(0), Get<Type>(1),
+                                GetList<VarDecl>(2));
+        if (r[6]) fn->SetFunctionBody(Get<Stmt>(3));
+        n = fn;
+        break;
+      }
+
+      case TypeKind: {
+            // the built-in types are shared, not part of any one tree
+        const char *name = GetString(at, r[3]);
+        Type *builtins[] = { Type::intType, Type::doubleType, Type::boolType,
+                             Type::voidType, Type::nullType, Type::stringType,
+                             Type::errorType };
+        n = NULL;
+        for (int i = 0; i < sizeof(builtins) / sizeof(builtins[0]); i++)
+            if (builtins[i]->getTypeName() == name) n = builtins[i];
+        if (n == NULL)
+            Failure("Unknown type %s in tree image", name);
+        return n;
+      }
+      case NamedTypeKind:
+        n = new NamedType(Get<Identifier>(0));
+        break;
+      case ArrayTypeKind:
+        n = new ArrayType(loc, Get<Type>(0));
+        break;
+
+      case StmtBlockKind:
+        n = new StmtBlock(GetList<VarDecl>(0), GetList<Stmt>(1));
+        break;
+      case IfStmtKind:
+        n = new IfStmt(Get<Expr>(0), Get<Stmt>(1), Get<Stmt>(2));
+        break;
+      case ForStmtKind:
+        n = new ForStmt(Get<Expr>(0), Get<Expr>(1),
+                        Get<Expr>(2), Get<Stmt>(3));
+        break;
+      case WhileStmtKind:
+        n = new WhileStmt(Get<Expr>(0), Get<Stmt>(1));
+        break;
+      case BreakStmtKind:
+        n = new BreakStmt(loc);
+        break;
+      case ReturnStmtKind:
+        n = new ReturnStmt(loc, Get<Expr>(0));
+        break;
+      case PrintStmtKind:
+        n = new PrintStmt(GetList<Expr>(0));
+        break;
+
+      case EmptyExprKind:
+        n = new EmptyExpr();
+        break;
+      case IntConstantKind:
+        n = new IntConstant(loc, (int)r[3]);
+        break;
+      case DoubleConstantKind: {
+        double value;
+        memcpy(&value, r + 3, sizeof(value));
+        n = new DoubleConstant(loc, value);
+        break;
+      }
+      case BoolConstantKind:
+        n = new BoolConstant(loc, r[3] != 0);
+        break;
+      case StringConstantKind:
+        n = new StringConstant(loc, GetString(at, r[3]));
+        break;
+      case NullConstantKind:
+        n = new NullConstant(loc);
+        break;
+
+      case ArithmeticExprKind:
+        if (r[3])
+            n = new ArithmeticExpr(Get<Expr>(0), Get<Operator>(1), Get<Expr>(2));
+        else
+            n = new ArithmeticExpr(Get<Operator>(1), Get<Expr>(2));
+        break;
+      case RelationalExprKind:
+        n = new RelationalExpr(Get<Expr>(0), Get<Operator>(1), Get<Expr>(2));
+        break;
+      case EqualityExprKind:
+        n = new EqualityExpr(Get<Expr>(0), Get<Operator>(1), Get<Expr>(2));
+        break;
+      case LogicalExprKind:
+        if (r[3])
+            n = new LogicalExpr(Get<Expr>(0), Get<Operator>(1), Get<Expr>(2));
+        else
+            n = new LogicalExpr(Get<Operator>(1), Get<Expr>(2));
+        break;
+      case AssignExprKind:
+        n = new AssignExpr(Get<Expr>(0), Get<Operator>(1), Get<Expr>(2));
+        break;
+      case ThisKind:
+        n = new This(loc);
+        break;
+      case ArrayAccessKind:
+        n = new ArrayAccess(loc, Get<Expr>(0), Get<Expr>(1));
+        break;
+      case FieldAccessKind:
+        n = new FieldAccess(Get<Expr>(0), Get<Identifier>(1));
+        break;
+      case CallKind:
+        n = new Call(loc, Get<Expr>(0), Get<Identifier>(1),
+                     GetList<Expr>(2));
+        break;
+      case NewExprKind:
+        n = new NewExpr(loc, Get<NamedType>(0));
+        break;
+      case NewArrayExprKind:
+        n = new NewArrayExpr(loc, Get<Expr>(0), Get<Type>(1));
+        break;
+      case ReadIntegerExprKind:
+        n = new ReadIntegerExpr(loc);
+        break;
+      case ReadLineExprKind:
+        n = new ReadLineExpr(loc);
+        break;
+
+      default:
+        Failure("Bad node kind %u in tree image at word %u", r[0], at);
+    }
+        // some constructors work out the location from the children
+    n->location = loc;
+    return n;
+}
@@ -0,0 +1,102 @@
+/* File: astimage.h
+ * ----------------
+ * Saves a parsed tree, together with the source it came from, to a
+ * file, and loads it back, so that a source file which has not changed
+ * need not be scanned and parsed again. The command line options
+ * -emit-ast=<file> and -load-ast=<file> use these.
+ *
+ * An image is an array of 32-bit words, loaded with a single mmap. It
+ * holds no pointers: a record refers to an earlier one by how many
+ * words before it that one starts (0 standing for NULL), so an image
+ * means the same wherever it is mapped. Locations are kept as offsets
+ * into the source and moved onto the loading compilation's own
+ * numbering (see location.h) as the tree is built.
+ *
+ * Layout:
+ *    header   magic, version, length of the image in words, length of
+ *             the source in bytes, word at which the Program record is
+ *    source   the text followed by two NULs, padded to a whole word
+ *    records  one per node, list and string, referring only to records
+ *             before them:
+ *        node    kind, first and last location, then the node's fields
+ *        list    number of elements, then a reference to each
+ *        string  the characters and a NUL, padded to a whole word
+ *
+ * The nodes cannot be used straight out of the mapping (they have
+ * virtual functions, and some own symbol tables), so Read builds the
+ * tree again from the records, through the node constructors and into
+ * the compilation's arena. That is still far less work than scanning
+ * and parsing. Neither writing nor reading recurses, so an image can
+ * hold a tree as deeply nested as the parser accepts.
+ */
+
+#ifndef _H_astimage
+#define _H_astimage
+
+#include <stdlib.h>   // for NULL
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include "location.h"
+
+class Compilation;
+class Node;
+class Program;
+template<class Element> class NodeList;
+
+class AstImage
+{
+  public:
+          // Writes the source and tree of c to the file at path.
+    static void Write(Compilation *c, const char *path);
+
+          // Maps the image at path into c, which takes its source from
+          // the image. Fails if it is not an image from this compiler.
+    static void Map(Compilation *c, const char *path);
+
+          // Builds the tree held in the image mapped into c.
+    static Program *Read(Compilation *c);
+
+  private:
+    Compilation *compilation;
+    std::vector<uint32_t> words;    // the image being written
+    std::unordered_map<const char *, uint32_t> strings; // interned -> record
+    const uint32_t *image;          // or the one being read
+    uint32_t imageLength;
+
+          // The explicit stacks PutTree and GetTree walk the tree with.
+          // firstKid is where on written or built the results for the
+          // children start, once expanded has pushed them.
+    struct PendingNode { Node *node; size_t firstKid; bool expanded; };
+    struct PendingRecord { uint32_t record; size_t firstKid; bool expanded; };
+    std::vector<PendingNode> toWrite;
+    std::vector<uint32_t> written;
+    bool expanding;
+    size_t nextKid;
+    std::vector<PendingRecord> toRead;
+    std::vector<Node *> built;
+    size_t kid[4];                  // where on built each field of the
+    uint32_t kidCount[4];           // node being read starts, and its size
+
+    AstImage(Compilation *c) : compilation(c), image(NULL), imageLength(0),
+                               expanding(false), nextKid(0) {}
+
+    uint32_t PutTree(Node *root);
+    uint32_t PutNode(Node *n);
+    uint32_t Ref(Node *child);
+    template<class Element> uint32_t PutList(NodeList<Element> *list);
+    uint32_t PutString(const char *s);
+    uint32_t Begin(Node *n);
+    void PutRef(uint32_t at, uint32_t target);
+
+    Node *GetTree(uint32_t root);
+    void Need(uint32_t at);
+    Node *GetNode(uint32_t at, size_t firstKid);
+    template<class T> NodeList<T*> *GetList(int field);
+    template<class T> T *Get(int field);
+    const char *GetString(uint32_t at, uint32_t ref);
+    uint32_t Target(uint32_t at, uint32_t ref);
+    SourceLoc Loc(uint32_t offset);
+};
+
+#endif
@@ -0,0 +1,72 @@
+/* File: allocs.h
+ * --------------
+ * Counts the calls a benchmark makes to malloc, and the bytes they ask
+ * for. operator new, strdup and the STL containers all come to malloc
+ * in the end, and the definitions here stand in front of the C
+ * library's, so every allocation the program makes is seen.
+ *
+ * Include it in just the one file of the benchmark that has main, and
+ * take the difference of two calls to AllocsSoFar around the work to be
+ * measured. glibc only, as it hands on to __libc_malloc and friends.
+ */
+
+#ifndef _H_allocs
+#define _H_allocs
+
+#include <stddef.h>
+#include <stdlib.h>  // declared first, so the definitions below match
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *p, size_t size);
+void __libc_free(void *p);
+}
+
+struct AllocCount {
+    long calls;
+    size_t bytes;
+};
+
+static AllocCount allocsSoFar;
+
+extern "C" void *malloc(size_t size)
+{
+    allocsSoFar.calls++;
+    allocsSoFar.bytes += size;
+    return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size)
+{
+    allocsSoFar.calls++;
+    allocsSoFar.bytes += n * size;
+    return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *p, size_t size)
+{
+    allocsSoFar.calls++;
+    allocsSoFar.bytes += size;
+    return __libc_realloc(p, size);
+}
+
+extern "C" void free(void *p)
+{
+    __libc_free(p);
+}
+
+static AllocCount AllocsSoFar()
+{
+    return allocsSoFar;
+}
+
+static AllocCount AllocsSince(const AllocCount &then)
+{
+    AllocCount now = allocsSoFar;
+    now.calls -= then.calls;
+    now.bytes -= then.bytes;
+    return now;
+}
+
+#endif
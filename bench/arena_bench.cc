@@ -0,0 +1,101 @@
+/* File: arena_bench.cc
+ * --------------------
+ * Measures building and giving back the tree of the Decaf files named
+ * on the command line, repeated a thousand times:
+ * - parsing into a compilation, which allocates the tree from its
+ *   arena, and deleting the compilation, which releases the arena;
+ * - for comparison, making the same number of allocations of the same
+ *   total size one by one with malloc, as each node, list and table used
+ *   to be made with new, and freeing them one by one.
+ * The old nodes also each had their location copied to the heap, which
+ * the comparison leaves out, so it flatters malloc. (The compiler never
+ * did free them; the freeing shows what a process that compiles file
+ * after file would have had to pay.)
+ *
+ * Built and run on samples/blackjack.decaf by "make bench"; prints the
+ * milliseconds and the calls to malloc taken by each.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "allocs.h"
+#include "compilation.h"
+#include "parser.h"
+#include "errors.h"
+
+static double MsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+int main(int argc, char *argv[])
+{
+    std::string text;
+    for (int i = 1; i < argc; i++) {
+        FILE *fp = fopen(argv[i], "r");
+        if (fp == NULL) {
+            printf("cannot open %s\n", argv[i]);
+            return 1;
+        }
+        char buf[65536];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+            text.append(buf, n);
+        fclose(fp);
+    }
+    if (text.empty()) {
+        printf("usage: arena_bench file.decaf ...\n");
+        return 1;
+    }
+    FILE *fp = tmpfile();
+    for (int i = 0; i < 1000; i++)
+        if (fp == NULL || fwrite(text.data(), 1, text.size(), fp) != text.size()) {
+            printf("cannot write the repeated text to a temporary file\n");
+            return 1;
+        }
+
+    InitParser();
+    printf("%d bytes\n", (int)text.size() * 1000);
+    for (int round = 0; round < 3; round++) {
+        rewind(fp);
+        Compilation *compilation = new Compilation(fp);
+        AllocCount before = AllocsSoFar();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Program *program = compilation->Parse();
+        double parseTime = MsSince(start);
+        AllocCount parseAllocs = AllocsSince(before);
+        if (program == NULL || ReportError::NumErrors() > 0) {
+            printf("the files do not parse\n");
+            return 1;
+        }
+        int numAllocations = compilation->arena.NumAllocations();
+        size_t numBytes = compilation->arena.NumBytes();
+        start = std::chrono::steady_clock::now();
+        delete compilation;
+        double releaseTime = MsSince(start);
+
+        std::vector<void *> objects(numAllocations);
+        size_t size = numBytes / numAllocations;
+        before = AllocsSoFar();
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < numAllocations; i++)
+            objects[i] = malloc(size);
+        double mallocTime = MsSince(start);
+        AllocCount mallocAllocs = AllocsSince(before);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < numAllocations; i++)
+            free(objects[i]);
+        double freeTime = MsSince(start);
+
+        printf("%d allocations from the arena, %.1f MB: parse %.0f ms with %ld mallocs, "
+               "release %.1f ms; by malloc %.0f ms with %ld mallocs, free %.0f ms\n",
+               numAllocations, numBytes / 1e6, parseTime, parseAllocs.calls, releaseTime,
+               mallocTime, mallocAllocs.calls, freeTime);
+    }
+    fclose(fp);
+    return 0;
+}
@@ -0,0 +1,173 @@
+/* File: intern_bench.cc
+ * ---------------------
+ * Measures what the scanner, the tree and the symbol tables do with the
+ * names in a program of 100,000 distinct identifiers, each appearing
+ * three times: once where it is declared, which enters it in a table,
+ * and twice where it is used, which looks it up. The occurrences are
+ * taken in a shuffled order, the declaration of each name coming first.
+ * Each occurrence is handled
+ * - as it used to be: copied into the token's char array, strdup'd for
+ *   its Identifier, and strdup'd again as the key when it is entered in
+ *   a multimap compared with strcmp, which is what Hashtable was;
+ * - as it is now: interned once, with the atom entered in and looked up
+ *   in a Hashtable by pointer.
+ * Every round uses names that have not been interned before, as a new
+ * run of the compiler would. Both ways must find the same declaration
+ * for every use.
+ *
+ * Built and run by "make bench"; prints nanoseconds per occurrence and
+ * the allocations made for each.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "allocs.h"
+#include "hashtable.h"
+#include "scanner.h"  // for MaxIdentLen
+
+struct ltstr {
+    bool operator()(const char *s1, const char *s2) const
+        { return strcmp(s1, s2) < 0; }
+};
+
+struct Occurrence {
+    int offset, len;    // of the spelling in the text
+    bool declaration;
+};
+
+/* Function: ByCopying
+ * -------------------
+ * Handles each occurrence the old way, and returns the number of uses
+ * that found the declaration of their own name.
+ */
+static int ByCopying(const std::string &text, const std::vector<Occurrence> &occurrences,
+                     std::vector<char *> *copies)
+{
+    std::multimap<const char *, const char *, ltstr> table;
+    int found = 0;
+    for (size_t i = 0; i < occurrences.size(); i++) {
+        char yylval[MaxIdentLen + 1];  // the token's copy
+        const Occurrence &o = occurrences[i];
+        memcpy(yylval, text.data() + o.offset, o.len);
+        yylval[o.len] = '\0';
+        char *name = strdup(yylval);   // the Identifier's
+        copies->push_back(name);
+        if (o.declaration) {
+            char *key = strdup(name);  // the table's
+            copies->push_back(key);
+            table.insert(std::make_pair(key, (const char *)name));
+        } else {
+            std::pair<std::multimap<const char *, const char *, ltstr>::iterator,
+                      std::multimap<const char *, const char *, ltstr>::iterator>
+                range = table.equal_range(name);
+            if (range.first != range.second && strcmp((--range.second)->second, name) == 0)
+                found++;
+        }
+    }
+    return found;
+}
+
+/* Function: ByInterning
+ * ---------------------
+ * Handles each occurrence as the compiler does now, and returns the
+ * number of uses that found the declaration of their own name.
+ */
+static int ByInterning(const std::string &text, const std::vector<Occurrence> &occurrences)
+{
+    Hashtable<const char *> table;
+    int found = 0;
+    for (size_t i = 0; i < occurrences.size(); i++) {
+        const Occurrence &o = occurrences[i];
+        const char *name = Intern(text.data() + o.offset, o.len);
+        if (o.declaration)
+            table.Enter(name, name, false);
+        else if (table.Lookup(name) == name)
+            found++;
+    }
+    return found;
+}
+
+/* Function: MakeProgram
+ * ---------------------
+ * Fills text with numNames distinct spellings, of assorted lengths up
+ * to MaxIdentLen and all starting with prefix, and occurrences with
+ * three of each, shuffled.
+ */
+static void MakeProgram(std::mt19937 &rng, const std::string &prefix, int numNames,
+                        std::string *text, std::vector<Occurrence> *occurrences)
+{
+    static const char *words[] = { "count", "i", "player", "deck", "Card", "value",
+                                   "total", "matrix", "row", "next", "x", "getName" };
+    std::vector<int> order;
+    for (int i = 0; i < numNames; i++) {
+        std::string name = prefix + words[rng() % 12] + std::to_string(i);
+        Occurrence o = { (int)text->size(), (int)std::min(name.size(), (size_t)MaxIdentLen), true };
+        text->append(name.data(), o.len);
+        *text += ' ';
+        occurrences->push_back(o);
+        order.push_back(i);
+        order.push_back(i);
+        order.push_back(i);
+    }
+    std::shuffle(order.begin(), order.end(), rng);
+    std::vector<bool> seen(numNames);
+    std::vector<Occurrence> names = *occurrences;
+    occurrences->clear();
+    for (size_t i = 0; i < order.size(); i++) {
+        Occurrence o = names[order[i]];
+        o.declaration = !seen[order[i]];
+        seen[order[i]] = true;
+        occurrences->push_back(o);
+    }
+}
+
+static double NsEach(int count, std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / count;
+}
+
+int main(int argc, char *argv[])
+{
+    const int numNames = 100000;
+    std::mt19937 rng(1);
+    printf("%d identifiers, %d occurrences\n", numNames, 3 * numNames);
+    for (int round = 0; round < 3; round++) {
+        std::string text;
+        std::vector<Occurrence> occurrences;
+        MakeProgram(rng, "r" + std::to_string(round) + "_", numNames, &text, &occurrences);
+
+        std::vector<char *> copies;
+        copies.reserve(2 * occurrences.size());
+        AllocCount before = AllocsSoFar();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int copyFound = ByCopying(text, occurrences, &copies);
+        double copyTime = NsEach(occurrences.size(), start);
+        AllocCount copyAllocs = AllocsSince(before);
+
+        before = AllocsSoFar();
+        start = std::chrono::steady_clock::now();
+        int internFound = ByInterning(text, occurrences);
+        double internTime = NsEach(occurrences.size(), start);
+        AllocCount internAllocs = AllocsSince(before);
+
+        if (copyFound != 2 * numNames || internFound != 2 * numNames) {
+            printf("copying found %d declarations and interning %d, expected %d\n",
+                   copyFound, internFound, 2 * numNames);
+            return 1;
+        }
+        printf("copying %.0f ns/occurrence, %ld allocations, %.1f MB; "
+               "interning %.0f ns/occurrence, %ld allocations, %.1f MB\n",
+               copyTime, copyAllocs.calls, copyAllocs.bytes / 1e6,
+               internTime, internAllocs.calls, internAllocs.bytes / 1e6);
+        for (size_t i = 0; i < copies.size(); i++)
+            free(copies[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/* File: keyword_bench.cc
+ * ----------------------
+ * Times how long the scanner takes to tell a reserved word from an
+ * identifier. The words are taken from the Decaf files named on the
+ * command line, and each is classified with KeywordToken, the perfect
+ * hash the scanner uses. For comparison, the same words are classified
+ * by comparing against each reserved word in turn, and by binary search
+ * of the sorted reserved words. The three must agree on every word.
+ *
+ * Built and run on samples/ by "make bench"; prints nanoseconds per
+ * word for each method.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "scanner.h"
+#include "parser.h"  // for the token codes
+
+struct Reserved {
+    const char *word;
+    int token;
+};
+
+static const Reserved reserved[] = {  // sorted, for the binary search
+    {"New", T_New}, {"NewArray", T_NewArray}, {"Print", T_Print},
+    {"ReadInteger", T_ReadInteger}, {"ReadLine", T_ReadLine},
+    {"bool", T_Bool}, {"break", T_Break}, {"class", T_Class},
+    {"double", T_Double}, {"else", T_Else}, {"extends", T_Extends},
+    {"false", T_BoolConstant}, {"for", T_For}, {"if", T_If},
+    {"implements", T_Implements}, {"int", T_Int},
+    {"interface", T_Interface}, {"null", T_Null}, {"return", T_Return},
+    {"string", T_String}, {"this", T_This}, {"true", T_BoolConstant},
+    {"void", T_Void}, {"while", T_While},
+};
+static const int NumReserved = sizeof(reserved) / sizeof(reserved[0]);
+
+static int LinearToken(const char *word, int len)
+{
+    for (int i = 0; i < NumReserved; i++)
+        if ((int)strlen(reserved[i].word) == len && !memcmp(reserved[i].word, word, len))
+            return reserved[i].token;
+    return 0;
+}
+
+static int BinarySearchToken(const char *word, int len)
+{
+    int lo = 0, hi = NumReserved;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strncmp(reserved[mid].word, word, len);
+        if (cmp == 0 && reserved[mid].word[len] != '\0')
+            cmp = 1;
+        if (cmp == 0)
+            return reserved[mid].token;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return 0;
+}
+
+struct Word {
+    const char *text;
+    int len;
+};
+
+/* Function: ReadWords
+ * -------------------
+ * Appends to store every run of letters, digits and '_' in the file
+ * that starts with a letter, as the {IDENTIFIER} rule would match them
+ * (those in comments and strings included).
+ */
+static bool ReadWords(const char *path, std::vector<std::string> &store)
+{
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL) {
+        printf("cannot open %s\n", path);
+        return false;
+    }
+    std::string word;
+    int ch;
+    do {
+        ch = fgetc(fp);
+        if (ch != EOF && (isalnum(ch) || ch == '_') && (!word.empty() || isalpha(ch))) {
+            word += (char)ch;
+        } else if (!word.empty()) {
+            store.push_back(word);
+            word.clear();
+        }
+    } while (ch != EOF);
+    fclose(fp);
+    return true;
+}
+
+template <class Classify> static double NsPerWord(Classify classify,
+                                                  const std::vector<Word> &words,
+                                                  int reps, long *sum)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++)
+        for (size_t i = 0; i < words.size(); i++)
+            *sum += classify(words[i].text, words[i].len);
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / ((double)reps * words.size());
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<std::string> store;
+    for (int i = 1; i < argc; i++)
+        if (!ReadWords(argv[i], store))
+            return 1;
+    if (store.empty()) {
+        printf("usage: keyword_bench file.decaf ...\n");
+        return 1;
+    }
+    std::vector<Word> words;
+    int numKeywords = 0;
+    for (size_t i = 0; i < store.size(); i++) {
+        Word w = { store[i].c_str(), (int)store[i].size() };
+        int token = KeywordToken(w.text, w.len);
+        if (token != LinearToken(w.text, w.len) || token != BinarySearchToken(w.text, w.len)) {
+            printf("the methods disagree on \"%s\"\n", w.text);
+            return 1;
+        }
+        numKeywords += (token != 0);
+        words.push_back(w);
+    }
+
+    int reps = std::max(1, 20000000 / (int)words.size());
+    long sum = 0;
+    printf("%d words, %d of them reserved\n", (int)words.size(), numKeywords);
+    for (int round = 0; round < 3; round++) {
+        double hash = NsPerWord(KeywordToken, words, reps, &sum);
+        double linear = NsPerWord(LinearToken, words, reps, &sum);
+        double search = NsPerWord(BinarySearchToken, words, reps, &sum);
+        printf("perfect hash %.2f ns/word, linear %.2f, binary search %.2f\n",
+               hash, linear, search);
+    }
+    return (sum == 0);
+}
@@ -0,0 +1,130 @@
+/* File: lines_bench.cc
+ * --------------------
+ * Measures keeping the source lines for error messages, over the Decaf
+ * files named on the command line repeated until there are at least a
+ * million lines:
+ * - by copying every line as it is scanned, as the COPY start state
+ *   used to (each line is stepped over a character at a time, as the
+ *   <COPY>.* rule did, and strdup'd into a List; an empty line is kept
+ *   as "");
+ * - by indexing where the lines start, as the scanner now does the
+ *   first time GetLineNumbered is called.
+ * The COPY rule also had the line scanned a second time after yyless(0),
+ * which is not counted here, so the copying figures flatter it. The two
+ * must give back the same text for every line.
+ *
+ * Built and run on samples/ by "make bench"; prints lines a second and
+ * the allocations and bytes asked of malloc for each.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include "allocs.h"
+#include "compilation.h"
+#include "list.h"
+
+/* Function: CopyLines
+ * -------------------
+ * Fills saved with a copy of each line of the text, as the COPY rule
+ * did, and returns the number of lines.
+ */
+static int CopyLines(const char *p, const char *end, List<const char *> *saved)
+{
+    while (p < end) {
+        const char *start = p;
+        while (p < end && *p != '\n')
+            p++;
+        if (p == start) {
+            saved->Append("");
+        } else {
+            saved->Append(strndup(start, p - start));
+        }
+        if (p < end) p++;  // the newline
+    }
+    return saved->NumElements();
+}
+
+static void FreeLines(List<const char *> *saved)
+{
+    for (int i = 0; i < saved->NumElements(); i++)
+        if (*saved->Nth(i) != '\0')
+            free((void *)saved->Nth(i));
+}
+
+static double MillionsPerSecond(int count, std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return count / elapsed.count() / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string text;
+    for (int i = 1; i < argc; i++) {
+        FILE *fp = fopen(argv[i], "r");
+        if (fp == NULL) {
+            printf("cannot open %s\n", argv[i]);
+            return 1;
+        }
+        char buf[65536];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+            text.append(buf, n);
+        fclose(fp);
+    }
+    if (text.empty() || text[text.size() - 1] != '\n') {
+        printf("usage: lines_bench file.decaf ... (each ending in a newline)\n");
+        return 1;
+    }
+    std::string copy = text;
+    int numLines = 0;
+    for (size_t i = 0; i < copy.size(); i++)
+        numLines += (copy[i] == '\n');
+    for (int n = numLines; numLines < 1000000; numLines += n)
+        text += copy;
+    FILE *fp = tmpfile();
+    if (fp == NULL || fwrite(text.data(), 1, text.size(), fp) != text.size()) {
+        printf("cannot write the repeated text to a temporary file\n");
+        return 1;
+    }
+    const char *begin = text.data(), *end = begin + text.size();
+
+    printf("%d lines, %d bytes\n", numLines, (int)text.size());
+    for (int round = 0; round < 3; round++) {
+        List<const char *> saved;
+        AllocCount before = AllocsSoFar();
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        int copied = CopyLines(begin, end, &saved);
+        double copyRate = MillionsPerSecond(numLines, start);
+        AllocCount copyAllocs = AllocsSince(before);
+
+        rewind(fp);
+        Compilation *compilation = new Compilation(fp);
+        before = AllocsSoFar();
+        start = std::chrono::steady_clock::now();
+        GetLineNumbered(compilation, 1);  // builds the index
+        double indexRate = MillionsPerSecond(numLines, start);
+        AllocCount indexAllocs = AllocsSince(before);
+
+        if (copied != numLines || (int)compilation->lineStarts.size() != numLines + 1) {
+            printf("copied %d lines and indexed %d, expected %d\n", copied,
+                   (int)compilation->lineStarts.size() - 1, numLines);
+            return 1;
+        }
+        for (int i = 0; i < numLines; i += 997)
+            if (strcmp(saved.Nth(i), GetLineNumbered(compilation, i + 1)) != 0) {
+                printf("line %d differs\n", i + 1);
+                return 1;
+            }
+        printf("copying %.1f M lines/s, %ld allocations, %.1f MB; "
+               "indexing %.1f M lines/s, %ld allocations, %.1f MB\n",
+               copyRate, copyAllocs.calls, copyAllocs.bytes / 1e6,
+               indexRate, indexAllocs.calls, indexAllocs.bytes / 1e6);
+        delete compilation;
+        FreeLines(&saved);
+    }
+    fclose(fp);
+    return 0;
+}
@@ -0,0 +1,164 @@
+/* File: literal_bench.cc
+ * ----------------------
+ * Times turning numeric constants into their values with the routines
+ * in literals.h, against strtol and atof on the same NUL-terminated text,
+ * as the scanner's actions used to. The constants are those in the Decaf
+ * files named on the command line, found as the {INTEGER}, {HEX_INTEGER}
+ * and {DOUBLE} patterns would match them (outside comments and strings),
+ * and repeated until there are a million of them. The two ways must
+ * give the same value for every constant that fits.
+ *
+ * Built and run by "make bench" on samples/matrix.decaf and on
+ * bench/constants.decaf, which has the double and hex constants that
+ * matrix.decaf lacks; prints nanoseconds per constant for each.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "literals.h"
+
+typedef enum { Decimal, Hex, Double } Kind;
+
+struct Constant {
+    int offset, len;    // of the text, which is followed by a NUL
+    Kind kind;
+};
+
+/* Function: FindConstants
+ * -----------------------
+ * Appends the text of each numeric constant in src to store, and where
+ * it is to constants. Comments and string constants are stepped over
+ * whole, and so are identifiers, so that the digits in "row2" are not
+ * taken for a constant.
+ */
+static void FindConstants(const std::string &src, std::string *store,
+                          std::vector<Constant> *constants)
+{
+    size_t i = 0, n = src.size();
+    while (i < n) {
+        size_t start = i;
+        if (src.compare(i, 2, "//") == 0) {
+            while (i < n && src[i] != '\n') i++;
+        } else if (src.compare(i, 2, "/*") == 0) {
+            size_t close = src.find("*/", i + 2);
+            i = (close == std::string::npos ? n : close + 2);
+        } else if (src[i] == '"') {
+            for (i++; i < n && src[i] != '"' && src[i] != '\n'; i++) ;
+            if (i < n) i++;
+        } else if (isalpha(src[i])) {
+            while (i < n && (isalnum(src[i]) || src[i] == '_')) i++;
+        } else if (isdigit(src[i])) {
+            Kind kind = Decimal;
+            if (src[i] == '0' && i + 2 < n && (src[i+1] == 'x' || src[i+1] == 'X') &&
+                isxdigit(src[i+2])) {
+                kind = Hex;
+                for (i += 2; i < n && isxdigit(src[i]); i++) ;
+            } else {
+                while (i < n && isdigit(src[i])) i++;
+                if (i < n && src[i] == '.') {
+                    kind = Double;
+                    for (i++; i < n && isdigit(src[i]); i++) ;
+                    size_t e = i;
+                    if (e < n && (src[e] == 'e' || src[e] == 'E')) {
+                        e++;
+                        if (e < n && (src[e] == '+' || src[e] == '-')) e++;
+                        if (e < n && isdigit(src[e])) {
+                            for (i = e; i < n && isdigit(src[i]); i++) ;
+                        }
+                    }
+                }
+            }
+            Constant c = { (int)store->size(), (int)(i - start), kind };
+            store->append(src, start, i - start);
+            *store += '\0';
+            constants->push_back(c);
+        } else {
+            i++;
+        }
+    }
+}
+
+static double ByDecoding(const char *text, const Constant &c, bool *fits)
+{
+    const char *p = text + c.offset;
+    int value;
+    switch (c.kind) {
+      case Decimal: *fits = DecodeInteger(p, p + c.len, &value); return value;
+      case Hex:     *fits = DecodeHexInteger(p, p + c.len, &value); return value;
+      default:      *fits = true; return DecodeDouble(p, p + c.len);
+    }
+}
+
+static double ByLibrary(const char *text, const Constant &c)
+{
+    const char *p = text + c.offset;
+    switch (c.kind) {
+      case Decimal: return (int)strtol(p, NULL, 10);
+      case Hex:     return (int)strtol(p, NULL, 16);
+      default:      return atof(p);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::string store;
+    std::vector<Constant> found;
+    for (int i = 1; i < argc; i++) {
+        FILE *fp = fopen(argv[i], "r");
+        if (fp == NULL) {
+            printf("cannot open %s\n", argv[i]);
+            return 1;
+        }
+        std::string src;
+        char buf[65536];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+            src.append(buf, n);
+        fclose(fp);
+        FindConstants(src, &store, &found);
+    }
+    if (found.empty()) {
+        printf("usage: literal_bench file.decaf ...\n");
+        return 1;
+    }
+    std::vector<Constant> constants;
+    int counts[3] = { 0, 0, 0 };
+    while (constants.size() < 1000000)
+        for (size_t i = 0; i < found.size(); i++) {
+            constants.push_back(found[i]);
+            counts[found[i].kind]++;
+        }
+    const char *text = store.c_str();
+    for (size_t i = 0; i < found.size(); i++) {
+        bool fits;
+        double value = ByDecoding(text, found[i], &fits);
+        if (fits && value != ByLibrary(text, found[i])) {
+            printf("the two ways disagree on %s\n", text + found[i].offset);
+            return 1;
+        }
+    }
+
+    printf("%d constants: %d decimal, %d hex, %d double\n", (int)constants.size(),
+           counts[Decimal], counts[Hex], counts[Double]);
+    double sum = 0;
+    for (int round = 0; round < 3; round++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < constants.size(); i++) {
+            bool fits;
+            sum += ByDecoding(text, constants[i], &fits);
+        }
+        std::chrono::duration<double, std::nano> decoding = std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < constants.size(); i++)
+            sum += ByLibrary(text, constants[i]);
+        std::chrono::duration<double, std::nano> library = std::chrono::steady_clock::now() - start;
+        printf("decoding %.1f ns/constant, strtol and atof %.1f\n",
+               decoding.count() / constants.size(), library.count() / constants.size());
+    }
+    return (sum == 0);
+}
@@ -0,0 +1,148 @@
+/* File: nodelist_bench.cc
+ * -----------------------
+ * Measures the lists of children held by tree nodes, built and walked
+ * - as List, with a deque behind it, as they used to be;
+ * - as SmallList, frozen into a NodeList, as they are now.
+ * The lists have the sizes of those in the tree of
+ * samples/blackjack.decaf, 201 of them, most empty or of one or two
+ * elements; that mix is made a thousand times over. Each way builds
+ * them in a compilation of its own, and the memory it takes is what it
+ * asks of malloc: the arena's blocks, which hold the lists (and for
+ * SmallList the inline room left behind when they are frozen), and for
+ * List the deques' blocks too. Each way then walks every element of
+ * every list as the checks do, with NumElements and Nth. Both must see
+ * the same elements.
+ *
+ * Built and run by "make bench"; prints bytes a list and nanoseconds an
+ * element walked for each.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <chrono>
+#include <vector>
+#include "allocs.h"
+#include "compilation.h"
+#include "list.h"
+#include "nodelist.h"
+
+static const int sizes[][2] = {   // size, how many lists of it
+    {0, 79}, {1, 65}, {2, 19}, {3, 9}, {4, 16}, {5, 2}, {6, 3}, {7, 1},
+    {8, 2}, {9, 3}, {10, 1}, {15, 1},
+};
+static const int NumSizes = sizeof(sizes) / sizeof(sizes[0]);
+static const int Copies = 1000;
+
+struct Footprint {
+    int numLists, numElements;
+    size_t bytes;
+    double buildMs;
+};
+
+/* Function: MakeSizes
+ * -------------------
+ * The sizes of Copies times the lists in the mix, in the order the
+ * parser finishes them (the mix taken round and round).
+ */
+static std::vector<int> MakeSizes()
+{
+    std::vector<int> all;
+    for (int copy = 0; copy < Copies; copy++)
+        for (int s = 0; s < NumSizes; s++)
+            for (int k = 0; k < sizes[s][1]; k++)
+                all.push_back(sizes[s][0]);
+    return all;
+}
+
+static double MsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+template <class L> static long Walk(const std::vector<L *> &lists, int reps, double *nsEach)
+{
+    long sum = 0, walked = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++)
+        for (size_t i = 0; i < lists.size(); i++) {
+            L *list = lists[i];
+            for (int j = 0; j < list->NumElements(); j++)
+                sum += (intptr_t)list->Nth(j);
+            walked += list->NumElements();
+        }
+    *nsEach = MsSince(start) * 1e6 / walked;
+    return sum;
+}
+
+static Footprint BuildLists(const std::vector<int> &all, std::vector<List<Node*> *> *lists)
+{
+    Footprint f = { 0, 0, 0, 0 };
+    lists->reserve(all.size());
+    AllocCount before = AllocsSoFar();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < all.size(); i++) {
+        List<Node*> *list = new List<Node*>;
+        for (int j = 0; j < all[i]; j++)
+            list->Append((Node *)(intptr_t)(f.numElements++));
+        lists->push_back(list);
+    }
+    f.buildMs = MsSince(start);
+    f.numLists = all.size();
+    f.bytes = AllocsSince(before).bytes;
+    return f;
+}
+
+static Footprint BuildNodeLists(const std::vector<int> &all, std::vector<NodeList<Node*> *> *lists)
+{
+    Footprint f = { 0, 0, 0, 0 };
+    lists->reserve(all.size());
+    AllocCount before = AllocsSoFar();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < all.size(); i++) {
+        SmallList<Node*> *list = new SmallList<Node*>;
+        for (int j = 0; j < all[i]; j++)
+            list->Append((Node *)(intptr_t)(f.numElements++));
+        lists->push_back(list->Freeze());
+    }
+    f.buildMs = MsSince(start);
+    f.numLists = all.size();
+    f.bytes = AllocsSince(before).bytes;
+    return f;
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<int> all = MakeSizes();
+    FILE *empty = tmpfile();
+    for (int round = 0; round < 3; round++) {
+        std::vector<List<Node*> *> lists;
+        std::vector<NodeList<Node*> *> nodeLists;
+        rewind(empty);
+        Compilation *forLists = new Compilation(empty);
+        Footprint listPrint = BuildLists(all, &lists);
+        rewind(empty);
+        Compilation *forNodeLists = new Compilation(empty);
+        Footprint nodeListPrint = BuildNodeLists(all, &nodeLists);
+
+        int reps = 20;
+        double listNs, nodeListNs;
+        long listSum = Walk(lists, reps, &listNs);
+        long nodeListSum = Walk(nodeLists, reps, &nodeListNs);
+        if (listSum != nodeListSum || listPrint.numElements != nodeListPrint.numElements) {
+            printf("the two ways hold different elements\n");
+            return 1;
+        }
+        if (round == 0)
+            printf("%d lists, %d elements\n", listPrint.numLists, listPrint.numElements);
+        printf("List %.0f bytes/list, built in %.0f ms, walked %.2f ns/element; "
+               "NodeList %.0f bytes/list, built in %.0f ms, walked %.2f ns/element\n",
+               (double)listPrint.bytes / listPrint.numLists, listPrint.buildMs, listNs,
+               (double)nodeListPrint.bytes / nodeListPrint.numLists, nodeListPrint.buildMs,
+               nodeListNs);
+        delete forNodeLists;
+        delete forLists;
+    }
+    fclose(empty);
+    return 0;
+}
@@ -0,0 +1,142 @@
+/* File: textscan_bench.cc
+ * -----------------------
+ * Times the routines in textscan.h against plain loops that look at one
+ * character at a time, as stepping flex's DFA does. The text is the
+ * Decaf files named on the command line, and it is passed over the way
+ * the scanner's actions use the routines:
+ * - a run of spaces is skipped to its end;
+ * - a line comment is skipped to the newline;
+ * - a block comment is skipped to its closing star and slash;
+ * - a string constant is skipped to its closing quote or the newline.
+ * Every other character is stepped over one at a time. The newlines of
+ * the whole text are also counted, as indexing the lines does. Both
+ * ways must find the same constructs and the same number of lines.
+ *
+ * Built and run on samples/ by "make bench"; prints megabytes a second
+ * for each.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include "textscan.h"
+
+static const char *PlainSpanSpaces(const char *p, const char *end)
+{
+    while (p < end && *p == ' ')
+        p++;
+    return p;
+}
+
+static const char *PlainFindEither(const char *p, const char *end, char a, char b)
+{
+    while (p < end && *p != a && *p != b)
+        p++;
+    return p;
+}
+
+static int PlainCountChar(const char *p, const char *end, char c)
+{
+    int n = 0;
+    for (; p < end; p++)
+        n += (*p == c);
+    return n;
+}
+
+struct Ops {
+    const char *(*spanSpaces)(const char *, const char *);
+    const char *(*findEither)(const char *, const char *, char, char);
+    int (*countChar)(const char *, const char *, char);
+};
+
+/* Function: SkipAll
+ * -----------------
+ * Passes over the text as the scanner does, and returns how many runs
+ * of spaces, comments and strings it skipped.
+ */
+static long SkipAll(const Ops &ops, const char *p, const char *end)
+{
+    long skipped = 0;
+    while (p < end) {
+        if (*p == ' ') {
+            p = ops.spanSpaces(p, end);
+        } else if (*p == '/' && p + 1 < end && p[1] == '/') {
+            p = ops.findEither(p + 2, end, '\n', '\n');
+        } else if (*p == '/' && p + 1 < end && p[1] == '*') {
+            const char *stop = p + 2;
+            while ((stop = ops.findEither(stop, end, '*', '*')) < end &&
+                   !(stop + 1 < end && stop[1] == '/'))
+                stop++;
+            p = (stop < end ? stop + 2 : end);
+        } else if (*p == '"') {
+            p = ops.findEither(p + 1, end, '"', '\n');
+            if (p < end && *p == '"')
+                p++;
+        } else {
+            p++;
+            continue;
+        }
+        skipped++;
+    }
+    return skipped;
+}
+
+static double MBPerSecond(size_t bytes, int reps, std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (double)bytes * reps / elapsed.count() / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    std::string text;
+    for (int i = 1; i < argc; i++) {
+        FILE *fp = fopen(argv[i], "r");
+        if (fp == NULL) {
+            printf("cannot open %s\n", argv[i]);
+            return 1;
+        }
+        char buf[65536];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0)
+            text.append(buf, n);
+        fclose(fp);
+    }
+    if (text.empty()) {
+        printf("usage: textscan_bench file.decaf ...\n");
+        return 1;
+    }
+    const char *begin = text.data(), *end = begin + text.size();
+    Ops vector = { SpanSpaces, FindEither, CountChar };
+    Ops plain = { PlainSpanSpaces, PlainFindEither, PlainCountChar };
+    long skipped = SkipAll(vector, begin, end);
+    int lines = CountChar(begin, end, '\n');
+    if (skipped != SkipAll(plain, begin, end) || lines != PlainCountChar(begin, end, '\n')) {
+        printf("the routines and the plain loops disagree\n");
+        return 1;
+    }
+
+    int reps = std::max(1, (int)(200000000 / text.size()));
+    long sum = 0;
+    printf("%d bytes, %ld runs of spaces, comments and strings, %d lines (%s)\n",
+           (int)text.size(), skipped, lines, TextScanVersion());
+    for (int round = 0; round < 3; round++) {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) sum += SkipAll(vector, begin, end);
+        double skipVector = MBPerSecond(text.size(), reps, start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) sum += SkipAll(plain, begin, end);
+        double skipPlain = MBPerSecond(text.size(), reps, start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) sum += CountChar(begin, end, '\n');
+        double countVector = MBPerSecond(text.size(), reps, start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) sum += PlainCountChar(begin, end, '\n');
+        double countPlain = MBPerSecond(text.size(), reps, start);
+        printf("skipping %.0f MB/s, plain %.0f; counting lines %.0f MB/s, plain %.0f\n",
+               skipVector, skipPlain, countVector, countPlain);
+    }
+    return (sum == 0);
+}
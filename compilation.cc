@@ -0,0 +1,704 @@
+/* File: compilation.cc
+ * --------------------
+ * Implementation of the Compilation class.
+ */
+
+#include "compilation.h"
+#include "parser.h"  // for yyparse, ScanToken
+#include "tokens.h"
+#include "textscan.h" // for FindEither
+#include "astimage.h"
+#include "symtab.h"
+#include "utility.h"
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <sys/mman.h> // for munmap
+#include <unistd.h>   // for read
+#include <errno.h>
+
+static thread_local Compilation *current = NULL;
+
+/* Location numbering
+ * ------------------
+ * Each compilation's source takes up sourceLength + 1 numbers (one more
+ * for the end of the input) of the SourceLoc numbering, in the first gap
+ * between the stretches of the compilations alive that is long enough.
+ * A compilation's stretch is free again once it is destroyed, so a
+ * process that compiles one file after another only runs out of numbers
+ * if the sources alive at once do. The compilations are kept in order of
+ * base, so the one a location falls in is found by binary search.
+ */
+static std::mutex sourcesLock;
+static std::vector<Compilation *> sources;
+static const uint64_t FirstBase = 1;    // 0 is no location
+
+static bool BaseLess(SourceLoc loc, const Compilation *c) { return loc < c->sourceBase; }
+
+// A file is only split for parallel scanning into pieces of at least
+// this size, and into at most this many pieces per thread (more pieces
+// than threads evens out the load).
+static const size_t MinChunkBytes = 1 << 20;
+static const int ChunksPerThread = 4;
+
+// The tokens are only split for parallel parsing into slices of at
+// least this many (and, as above, at most ChunksPerThread per thread).
+static const int MinSliceTokens = 1 << 16;
+
+// Most read at a time from streamed input (as much as a pipe holds).
+static const size_t StreamBlockBytes = 64 * 1024;
+
+static const uint64_t EndOfNumbering = (uint64_t)UINT32_MAX + 1;
+
+
+Compilation::Compilation(FILE *fp, ScanMode mode)
+  : scanner(NULL), sourceText(NULL), sourceLength(0), sourceBase(0),
+    numberingEnd(0), sourceMapped(false), stableText(NULL), program(NULL),
+    astImage(NULL), astImageLength(0), scanMode(mode),
+    scanThreads(std::thread::hardware_concurrency()), dumpTokens(false),
+    tokens(NULL), ring(NULL), parallelParse(false), streamFd(-1),
+    streamCapacity(0) {
+    Assert(fp != NULL);
+    current = this;
+    if (mode == ScanStream) {
+        streamFd = fileno(fp);
+        if ((sourceText = (char *)calloc(2, 1)) == NULL)
+            Failure("Out of memory reading input");
+        streamCapacity = 2;
+    } else {
+        InitScanner(this, fp);
+    }
+    Register();
+}
+
+Compilation::Compilation(const char *astFile)
+  : scanner(NULL), sourceText(NULL), sourceLength(0), sourceBase(0),
+    numberingEnd(0), sourceMapped(false), stableText(NULL), program(NULL),
+    astImage(NULL), astImageLength(0), scanMode(ScanOnDemand),
+    scanThreads(1), dumpTokens(false), tokens(NULL), ring(NULL),
+    parallelParse(false), streamFd(-1), streamCapacity(0) {
+    Assert(astFile != NULL);
+    current = this;
+    AstImage::Map(this, astFile);
+    Register();
+}
+
+/* Function: Register()
+ * --------------------
+ * Gives the source its stretch of the location numbering. How long a
+ * streamed source is will not be known until it has all been read, so
+ * it is given the longest gap there is, and EndStream gives back what
+ * it did not need.
+ */
+void Compilation::Register() {
+    std::lock_guard<std::mutex> hold(sourcesLock);
+    uint64_t need = sourceLength + 1, bestStart = 0, bestEnd = 0;
+    size_t bestAt = 0;
+    for (size_t i = 0; i <= sources.size(); i++) {
+        uint64_t start = (i == 0 ? FirstBase : sources[i-1]->numberingEnd);
+        uint64_t end = (i == sources.size() ? EndOfNumbering : sources[i]->sourceBase);
+        if (end - start < need || (bestEnd > bestStart && end - start <= bestEnd - bestStart))
+            continue;
+        bestStart = start;
+        bestEnd = end;
+        bestAt = i;
+        if (streamFd < 0)
+            break;      // the first gap that fits will do
+    }
+    if (bestEnd - bestStart < need)
+        Failure("Too much source for 32-bit locations");
+    sourceBase = bestStart;
+    numberingEnd = (streamFd >= 0 ? bestEnd : bestStart + need);
+    sources.insert(sources.begin() + bestAt, this);
+}
+
+/* Constructor for a piece
+ * -----------------------
+ * The text is copied so it can be followed by the two NULs flex needs.
+ * A piece that starts inside a comment left open by the piece before
+ * gets a comment opener put in front of it, at column -1 so that the
+ * text proper still starts at location base: the scanner then skips to
+ * the end of the comment exactly as it would have in one pass over the
+ * whole source, and everything after it comes out the same. A piece
+ * takes no numbers of its own; its locations are those of the source
+ * it was cut from.
+ */
+Compilation::Compilation(const char *text, size_t length, SourceLoc base, bool inComment)
+  : scanner(NULL), sourceText(NULL), sourceLength(0), sourceBase(0),
+    numberingEnd(0), sourceMapped(false), stableText(NULL), program(NULL),
+    astImage(NULL), astImageLength(0), scanMode(ScanAhead),
+    scanThreads(1), dumpTokens(false), tokens(NULL), ring(NULL),
+    parallelParse(false), streamFd(-1), streamCapacity(0) {
+    size_t prefix = (inComment ? 2 : 0);
+    sourceLength = prefix + length;
+    if ((sourceText = (char *)malloc(sourceLength + 2)) == NULL)
+        Failure("Out of memory copying input");
+    memcpy(sourceText, "/*", prefix);
+    memcpy(sourceText + prefix, text, length);
+    sourceText[sourceLength] = sourceText[sourceLength+1] = '\0';
+    InitScannerOnText(this);
+    sourceBase = base - prefix;
+}
+
+/* Constructor for a slice
+ * ------------------------
+ * A slice has no source or scanner of its own, only the tokens it is
+ * to parse, whose locations are those of the source they came from.
+ * Nothing is registered for it, so its messages are located in that
+ * source too.
+ */
+Compilation::Compilation(TokenBuffer *sliceTokens)
+  : scanner(NULL), sourceText(NULL), sourceLength(0), sourceBase(0),
+    numberingEnd(0), sourceMapped(false), stableText(NULL), program(NULL),
+    astImage(NULL), astImageLength(0), scanMode(ScanAhead),
+    scanThreads(1), dumpTokens(false), tokens(sliceTokens), ring(NULL),
+    parallelParse(false), streamFd(-1), streamCapacity(0) {}
+
+Compilation::~Compilation() {
+    if (arena.NumAllocations() > 0)
+        PrintDebug("arena", "Released %d allocations, %lu bytes in %d blocks",
+                   arena.NumAllocations(), (unsigned long)arena.NumBytes(),
+                   arena.NumBlocks());
+    if (astImage) {
+        sourceText = NULL;  // lies inside the image
+        munmap((void *)astImage, astImageLength);
+    }
+    FreeScanner(this);
+    delete tokens;
+    delete ring;
+    for (int i = 0; i < slices.size(); i++)
+        delete slices[i];
+    free((char *)stableText);
+    if (current == this) current = NULL;
+
+    std::lock_guard<std::mutex> hold(sourcesLock);
+    std::vector<Compilation *>::iterator it = std::find(sources.begin(), sources.end(), this);
+    if (it != sources.end()) sources.erase(it);
+}
+
+/* Function: ElapsedMs()
+ * ---------------------
+ * Milliseconds since start, for the "time" debug key.
+ */
+static double ElapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - start).count();
+}
+
+Program *Compilation::Parse() {
+    current = this;
+    dumpTokens = IsDebugOn("tokens");
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    int result = 1;
+
+    if (astImage) {
+        program = AstImage::Read(this);
+        PrintDebug("time", "Loaded tree in %.3f ms", ElapsedMs(start));
+        return program;
+    }
+    switch (scanMode) {
+      case ScanOnDemand:
+        result = yyparse(this);
+        PrintDebug("time", "Scanned and parsed in %.3f ms", ElapsedMs(start));
+        break;
+
+      case ScanAhead:
+      case ScanParallel:
+        tokens = new TokenBuffer;
+        if (scanMode == ScanParallel)
+            ScanInParallel();
+        else
+            ScanAll();
+        PrintDebug("time", "Scanned %d tokens in %.3f ms", tokens->NumTokens(),
+                   ElapsedMs(start));
+        start = std::chrono::steady_clock::now();
+        result = (parallelParse && !dumpTokens ? ParseInParallel() : yyparse(this));
+        PrintDebug("time", "Parsed in %.3f ms", ElapsedMs(start));
+        break;
+
+      case ScanOnThread: {
+            // the scanner writes into sourceText as it goes (flex
+            // NUL-terminates each lexeme in place), so error messages
+            // printed meanwhile take their lines from a copy
+        char *copy = (char *)malloc(sourceLength + 1);
+        if (copy == NULL) Failure("Out of memory copying input");
+        memcpy(copy, sourceText, sourceLength + 1);
+        stableText = copy;
+        ring = new TokenRing;
+        std::thread scanThread(&Compilation::ScanIntoRing, this);
+        result = yyparse(this);
+        ring->Close();
+        scanThread.join();
+        PrintDebug("time", "Scanned and parsed on two threads in %.3f ms",
+                   ElapsedMs(start));
+        break;
+      }
+
+      case ScanStream:
+        result = ParseStream();
+        PrintDebug("time", "Read, scanned and parsed in %.3f ms", ElapsedMs(start));
+        break;
+    }
+    return (result == 0 ? program : NULL);
+}
+
+/* Function: ParseStream()
+ * -----------------------
+ * Reads the source a block at a time, and pushes the tokens of each
+ * block through the parser before reading the next. Only the text up to
+ * the last newline read is scanned each time (the rest could be the
+ * start of a longer token), as a piece in the manner of ScanInParallel,
+ * with any comment left open carried over to the next piece. Returns
+ * what yyparse would have.
+ */
+int Compilation::ParseStream() {
+    tokens = new TokenBuffer;
+    yypstate *parser = yypstate_new();
+    if (parser == NULL)
+        Failure("Out of memory creating parser");
+    size_t scanned = 0;
+    bool inComment = false;
+    int status = YYPUSH_MORE;
+
+    while (status == YYPUSH_MORE) {
+        bool atEnd = !ReadBlock();
+        size_t cut = sourceLength;
+        if (!atEnd) {
+            const char *nl = (const char *)memrchr(sourceText + scanned, '\n',
+                                                   sourceLength - scanned);
+            if (nl == NULL) continue;
+            cut = nl + 1 - sourceText;
+        }
+        Compilation piece(sourceText + scanned, cut - scanned, sourceBase + scanned, inComment);
+        piece.tokens = new TokenBuffer;
+        piece.ScanAll();
+        inComment = ScannerInComment(&piece);
+        tokens->Splice(*piece.tokens, sourceBase + scanned, atEnd, inComment);
+        scanned = cut;
+
+        YYSTYPE value;
+        yyltype loc;
+        while (status == YYPUSH_MORE && tokens->NumLeft() > 0) {
+            int kind = NextToken(&value, &loc);
+            status = yypush_parse(parser, kind, &value, &loc, this);
+        }
+        if (tokens->NumLeft() == 0)
+            tokens->DropTaken();
+    }
+    yypstate_delete(parser);
+    EndStream();
+    return status;
+}
+
+/* Function: ReadBlock()
+ * ---------------------
+ * Reads whatever there is of the streamed input, up to a block, onto
+ * the end of sourceText, keeping the two NULs after it and adding the
+ * new lines to lineStarts if an error has already had them worked out.
+ * Returns false at the end of the input.
+ */
+bool Compilation::ReadBlock() {
+    if (sourceLength + StreamBlockBytes + 2 > streamCapacity) {
+        streamCapacity = std::max(2 * streamCapacity, sourceLength + StreamBlockBytes + 2);
+        if ((sourceText = (char *)realloc(sourceText, streamCapacity)) == NULL)
+            Failure("Out of memory reading input");
+    }
+    ssize_t n;
+    do {
+        n = read(streamFd, sourceText + sourceLength, StreamBlockBytes);
+    } while (n < 0 && errno == EINTR);
+    if (n <= 0)
+        return false;
+    if (sourceBase + sourceLength + n >= numberingEnd)
+        Failure("Too much source for 32-bit locations");
+
+    size_t old = sourceLength;
+    sourceLength += n;
+    sourceText[sourceLength] = sourceText[sourceLength+1] = '\0';
+    if (!lineStarts.empty()) {
+        for (const char *p = sourceText + old, *end = sourceText + sourceLength;
+             (p = (const char *)memchr(p, '\n', end - p)) != NULL; )
+            lineStarts.push_back(++p - sourceText);
+    }
+    return true;
+}
+
+/* Function: EndStream()
+ * ---------------------
+ * Once no more of the input will be read, gives back the part of the
+ * location numbering the source did not take.
+ */
+void Compilation::EndStream() {
+    std::lock_guard<std::mutex> hold(sourcesLock);
+    numberingEnd = sourceBase + sourceLength + 1;
+}
+
+/* Function: DeclParsed()
+ * ----------------------
+ * When the input is streamed, each top-level declaration is checked as
+ * soon as it is parsed, while the rest of the input is still arriving.
+ * The messages are held until Check: they are only wanted if the whole
+ * parse succeeds, and they come before those of the checks that need
+ * all the declarations (see Program::Check).
+ */
+void Compilation::DeclParsed(Decl *decl) {
+    if (scanMode != ScanStream)
+        return;
+    ReportError::DeferOutput(&heldChecks);
+    BuildScopes(decl);
+    CheckTree(decl);
+    ReportError::DeferOutput(NULL);
+}
+
+void Compilation::Check() {
+    Assert(program != NULL);
+    current = this;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (scanMode == ScanStream) {
+            // the declarations were each checked as they were parsed
+        for (int i = 0; i < heldChecks.size(); i++)
+            ReportError::Replay(heldChecks[i]);
+        heldChecks.clear();
+        program->checkDeclErr();
+    } else {
+        program->Check();
+    }
+    PrintDebug("time", "Checked in %.3f ms", ElapsedMs(start));
+    PrintDebug("stats", "Looked up %lu names in declaration tables, %lu in scopes",
+               Hashtable<Decl*>::NumLookups(), SymbolTable::NumLookups());
+}
+
+void Compilation::EmitAst(const char *path) {
+    Assert(program != NULL);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    AstImage::Write(this, path);
+    PrintDebug("time", "Wrote tree image in %.3f ms", ElapsedMs(start));
+}
+
+int Compilation::NextToken(YYSTYPE *value, yyltype *loc) {
+    int kind;
+    switch (scanMode) {
+      case ScanOnThread: kind = ring->Take(value, loc); break;
+      case ScanOnDemand: kind = ScanToken(value, loc, scanner); break;
+      default:           kind = tokens->Next(value, loc); break;
+    }
+    if (dumpTokens) DumpToken(kind, value, loc);
+    return kind;
+}
+
+/* Function: DumpToken()
+ * ---------------------
+ * Prints a token under the "tokens" debug key, in a form that lets the
+ * token streams from the different scan modes be compared with diff.
+ */
+void Compilation::DumpToken(int kind, YYSTYPE *value, yyltype *loc) {
+    SourcePosition pos;
+    Locate(*loc, &pos);
+    char text[64] = "";
+    switch (kind) {
+      case T_Identifier:     snprintf(text, sizeof(text), " %s", value->identifier); break;
+      case T_IntConstant:    snprintf(text, sizeof(text), " %d", value->integerConstant); break;
+      case T_DoubleConstant: snprintf(text, sizeof(text), " %.17g", value->doubleConstant); break;
+      case T_StringConstant: snprintf(text, sizeof(text), " %.40s", value->stringConstant); break;
+      case T_BoolConstant:   snprintf(text, sizeof(text), " %d", value->boolConstant); break;
+    }
+    PrintDebug("tokens", "%d.%d-%d %d%s", pos.first_line, pos.first_column,
+               pos.last_column, kind, text);
+}
+
+/* Function: ScanAll()
+ * -------------------
+ * Scans the whole source into the token buffer, holding back any
+ * messages to be printed as the parser reaches them.
+ */
+void Compilation::ScanAll() {
+    MessageList held;
+    YYSTYPE value;
+    yyltype loc = yyltype();
+    int kind;
+
+    ReportError::DeferOutput(&held);
+    do {
+        kind = ScanToken(&value, &loc, scanner);
+        tokens->Append(kind, value, loc, held);
+    } while (kind != 0);
+    ReportError::DeferOutput(NULL);
+}
+
+/* Struct: ChunkPlan
+ * -----------------
+ * How the source is split for ScanInParallel: the offset of each piece
+ * (with the source length at the end), the compilation each piece was
+ * scanned with, and the next piece waiting for a thread.
+ */
+struct Compilation::ChunkPlan {
+    std::vector<size_t> starts;
+    std::vector<Compilation *> chunks;
+    std::atomic<int> next;
+};
+
+/* Function: ScanInParallel()
+ * --------------------------
+ * Scans the whole source into the token buffer using several threads,
+ * giving the same tokens and messages as ScanAll would.
+ *
+ * The source is split just after newlines into pieces that are scanned
+ * at the same time, each by a scanner of its own into a buffer of its
+ * own. Locations are offsets, so each piece's come out right just by
+ * starting from its offset. The only thing that can carry over
+ * from one line to the next is a block comment, so each piece is first
+ * scanned as if it started outside any comment. Then, in order, any
+ * piece following one that ended inside a comment is scanned again as
+ * starting inside it; that is rare, and it settles whether the piece
+ * after it is in a comment too. Last, the pieces' tokens are spliced
+ * together in order.
+ */
+void Compilation::ScanInParallel() {
+    ChunkPlan plan;
+    const char *end = sourceText + sourceLength;
+    int threads = (scanThreads > 0 ? scanThreads : 1);
+    size_t wanted = sourceLength / MinChunkBytes;
+    if (wanted > (size_t)threads * ChunksPerThread)
+        wanted = threads * ChunksPerThread;
+
+    plan.starts.push_back(0);
+    for (size_t k = 1; k < wanted; k++) {
+        const char *cut = sourceText + sourceLength / wanted * k;
+        if (cut <= sourceText + plan.starts.back()) continue;
+        cut = FindEither(cut, end, '\n', '\n');
+        if (cut + 1 >= end) break;
+        plan.starts.push_back(cut + 1 - sourceText);
+    }
+    int numChunks = plan.starts.size();
+    plan.starts.push_back(sourceLength);
+    if (numChunks == 1) {
+        ScanAll();
+        return;
+    }
+
+    plan.chunks.resize(numChunks);
+    plan.next = 0;
+    if (threads > numChunks) threads = numChunks;
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threads; i++)
+        workers.push_back(std::thread(&Compilation::ScanChunks, this, &plan));
+    ScanChunks(&plan);
+    for (int i = 0; i < workers.size(); i++)
+        workers[i].join();
+
+    int rescanned = 0;
+    for (int k = 1; k < numChunks; k++) {
+        if (ScannerInComment(plan.chunks[k-1])) {
+            delete plan.chunks[k];
+            plan.chunks[k] = ScanChunk(&plan, k, true);
+            rescanned++;
+        }
+    }
+    PrintDebug("lex", "Scanned %d pieces on %d threads, %d rescanned",
+               numChunks, threads, rescanned);
+
+    for (int k = 0; k < numChunks; k++) {
+        tokens->Splice(*plan.chunks[k]->tokens, sourceBase + plan.starts[k],
+                       k == numChunks - 1, ScannerInComment(plan.chunks[k]));
+        delete plan.chunks[k];
+    }
+}
+
+/* Function: ScanChunks()
+ * ----------------------
+ * Body of each thread of ScanInParallel: takes pieces not yet scanned
+ * until there are none left.
+ */
+void Compilation::ScanChunks(ChunkPlan *plan) {
+    int k;
+    while ((k = plan->next++) < plan->chunks.size())
+        plan->chunks[k] = ScanChunk(plan, k, false);
+}
+
+/* Function: ScanChunk()
+ * ---------------------
+ * Scans piece k of the plan into a token buffer of its own and returns
+ * the compilation holding it.
+ */
+Compilation *Compilation::ScanChunk(ChunkPlan *plan, int k, bool inComment) {
+    Compilation *chunk = new Compilation(sourceText + plan->starts[k],
+                                         plan->starts[k+1] - plan->starts[k],
+                                         sourceBase + plan->starts[k], inComment);
+    chunk->tokens = new TokenBuffer;
+    chunk->ScanAll();
+    return chunk;
+}
+
+/* Struct: SlicePlan
+ * -----------------
+ * How the tokens are split for ParseInParallel: the index of the first
+ * token of each slice (with the number of tokens at the end), and for
+ * each slice, the compilation it was parsed in, what yyparse returned
+ * and the messages held back meanwhile; and the next slice waiting for
+ * a thread.
+ */
+struct Compilation::SlicePlan {
+    std::vector<int> starts;
+    std::vector<Compilation *> slices;
+    std::vector<int> results;
+    std::vector<MessageList> held;
+    std::atomic<int> next;
+};
+
+/* Function: ParseInParallel()
+ * ---------------------------
+ * Parses the scanned tokens on several threads, building the same tree
+ * and printing the same messages as yyparse would, and returns what it
+ * would have.
+ *
+ * The tokens are cut into slices just after a '}' or ';' that leaves no
+ * brace open. In a program that parses, every such token ends a
+ * top-level declaration, and a program is just a list of declarations,
+ * so each slice parses on its own into the same declarations it would
+ * have given as part of the whole. The slices are parsed at the same
+ * time, each on a thread and into an arena of its own, with their
+ * messages held back; then the messages are printed and the
+ * declarations gathered into one Program, in order.
+ *
+ * Conversely, if every slice parses, so does the whole. When one does
+ * not, its error may not be the one the whole would give (and may be
+ * reported at the wrong place), so the slices are thrown away and the
+ * whole is parsed again by yyparse, which finds the error properly.
+ */
+int Compilation::ParseInParallel() {
+    SlicePlan plan;
+    int numTokens = tokens->NumTokens() - 1;    // leaving out the end of input
+    int threads = (scanThreads > 0 ? scanThreads : 1);
+    int wanted = std::min(numTokens / MinSliceTokens, threads * ChunksPerThread);
+
+    plan.starts.push_back(0);
+    if (wanted > 1) {
+        int target = numTokens / wanted, depth = 0;
+        for (int i = 0; i < numTokens - 1; i++) {
+            int kind = tokens->KindAt(i);
+            if (kind == '{') depth++;
+            else if (kind == '}') depth--;
+            else if (kind != ';') continue;
+            if (depth == 0 && i + 1 - plan.starts.back() >= target)
+                plan.starts.push_back(i + 1);
+        }
+    }
+    int numSlices = plan.starts.size();
+    if (numSlices == 1)
+        return yyparse(this);
+    plan.starts.push_back(numTokens + 1);
+
+    plan.slices.resize(numSlices);
+    plan.results.resize(numSlices);
+    plan.held.resize(numSlices);
+    plan.next = 0;
+    if (threads > numSlices) threads = numSlices;
+    std::vector<std::thread> workers;
+    for (int i = 1; i < threads; i++)
+        workers.push_back(std::thread(&Compilation::ParseSlices, this, &plan));
+    ParseSlices(&plan);
+    for (int i = 0; i < workers.size(); i++)
+        workers[i].join();
+    current = this;
+
+    bool parsed = true;
+    for (int k = 0; k < numSlices; k++)
+        parsed = parsed && plan.results[k] == 0;
+    PrintDebug("parse", "Parsed %d slices on %d threads%s", numSlices, threads,
+               parsed ? "" : ", parsing again in one");
+    if (!parsed) {
+        for (int k = 0; k < numSlices; k++)
+            delete plan.slices[k];
+        return yyparse(this);
+    }
+
+    SmallList<Decl*> *decls = new SmallList<Decl*>;
+    for (int k = 0; k < numSlices; k++) {
+        Compilation *slice = plan.slices[k];
+        for (int i = 0; i < plan.held[k].size(); i++)
+            ReportError::Replay(plan.held[k][i]);
+        NodeList<Decl*> *part = slice->program->GetDecls();
+        for (int i = 0; i < part->NumElements(); i++)
+            decls->Append(part->Nth(i));
+        slices.push_back(slice);
+    }
+    program = new Program(decls->Freeze());
+    return 0;
+}
+
+/* Function: ParseSlices()
+ * -----------------------
+ * Body of each thread of ParseInParallel: takes slices not yet parsed
+ * until there are none left.
+ */
+void Compilation::ParseSlices(SlicePlan *plan) {
+    int k;
+    while ((k = plan->next++) < plan->slices.size()) {
+        Compilation *slice = new Compilation(new TokenBuffer(*tokens, plan->starts[k],
+                                                             plan->starts[k+1]));
+        current = slice;
+        ReportError::DeferOutput(&plan->held[k]);
+        plan->results[k] = yyparse(slice);
+        ReportError::DeferOutput(NULL);
+        current = NULL;
+        plan->slices[k] = slice;
+    }
+}
+
+/* Function: ScanIntoRing()
+ * ------------------------
+ * Body of the scanner thread: as ScanAll, but passes the tokens on
+ * through the ring, and stops early if the parser gives up.
+ */
+void Compilation::ScanIntoRing() {
+    MessageList held;
+    YYSTYPE value;
+    yyltype loc = yyltype();
+    int kind;
+
+    current = this;
+    ReportError::DeferOutput(&held);
+    do {
+        kind = ScanToken(&value, &loc, scanner);
+    } while (ring->Put(kind, value, loc, held) && kind != 0);
+    ReportError::DeferOutput(NULL);
+}
+
+Compilation *Compilation::Current() {
+    return current;
+}
+
+Compilation *Compilation::Locate(const yyltype &loc, SourcePosition *pos) {
+    Compilation *owner = NULL;
+    *pos = SourcePosition();
+    {
+        std::lock_guard<std::mutex> hold(sourcesLock);
+        std::vector<Compilation *>::iterator it =
+            std::upper_bound(sources.begin(), sources.end(), loc.first, BaseLess);
+        if (it != sources.begin()) {
+            --it;
+            if (loc.first - (*it)->sourceBase <= (*it)->sourceLength)
+                owner = *it;
+        }
+    }
+    if (owner == NULL)
+        return NULL;
+    GetLineAndColumn(owner, loc.first - owner->sourceBase,
+                     &pos->first_line, &pos->first_column);
+    GetLineAndColumn(owner, loc.last - owner->sourceBase,
+                     &pos->last_line, &pos->last_column);
+    return owner;
+}
+
+
+/* Function: yylex()
+ * -----------------
+ * The parser's source of tokens; see the %lex-param in parser.y.
+ */
+int yylex(YYSTYPE *lvalp, YYLTYPE *llocp, Compilation *c) {
+    return c->NextToken(lvalp, llocp);
+}
@@ -0,0 +1,165 @@
+/* File: compilation.h
+ * -------------------
+ * A Compilation holds everything that belongs to translating one source
+ * file: the source text, the reentrant scanner working through it, the
+ * table of line starts used to turn locations into line numbers and
+ * print context for errors, and the tree the parser builds, together
+ * with the arena it is allocated from. None of this
+ * is global, so separate Compilations can be scanned and parsed at the
+ * same time on separate threads.
+ *
+ * By default the parser calls the scanner for each token as it needs
+ * it. The scanner can instead be run over the whole file first, into a
+ * TokenBuffer the parser then reads from, or on a thread of its own
+ * that passes tokens to the parser through a TokenRing (see tokens.h).
+ * For very large files, the whole-file scan can be split into pieces
+ * scanned in parallel and then spliced back together.
+ *
+ * Input arriving through a pipe or socket can instead be streamed: it
+ * is read a block at a time, and each block is scanned and pushed
+ * through the parser before the next is read, so parsing overlaps with
+ * whatever produces the input. Each top-level declaration is then also
+ * checked as soon as it is parsed, as far as it can be without the
+ * declarations after it.
+ *
+ * Once the whole file is scanned ahead, the parse too can be split
+ * over several threads, each parsing a run of top-level declarations
+ * into a slice compilation of its own; the declarations are then put
+ * back together in order into one Program, the same as a single parse
+ * would have built.
+ *
+ * Instead of source, a compilation can be given an image of a tree
+ * saved by an earlier one, which it loads rather than parsing.
+ *
+ * Sample usage:
+ *
+ *       Compilation compilation(stdin, Compilation::ScanAhead);
+ *       Program *program = compilation.Parse();
+ */
+
+#ifndef _H_compilation
+#define _H_compilation
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+#include <mutex>     // for once_flag
+#include "scanner.h"   // for yyscan_t
+#include "arena.h"
+#include "location.h"
+#include "errors.h"    // for ReportError::Message
+
+class Program;
+class Decl;
+class TokenBuffer;
+class TokenRing;
+union YYSTYPE;
+
+class Compilation
+{
+  public:
+    typedef enum { ScanOnDemand, ScanAhead, ScanOnThread, ScanParallel,
+                   ScanStream } ScanMode;
+
+            // Reads or maps all of fp and sets up a scanner on it, or
+            // for ScanStream, only gets ready to read fp as Parse goes.
+            // The new compilation becomes current on the calling thread.
+    Compilation(FILE *fp, ScanMode mode = ScanOnDemand);
+
+            // Maps a tree image written by EmitAst, from which Parse
+            // then takes the tree instead of scanning and parsing (see
+            // astimage.h).
+    Compilation(const char *astFile);
+    ~Compilation();
+
+            // Sets the number of threads used by ScanParallel (by
+            // default, one per processor).
+    void SetScanThreads(int n) { scanThreads = n; }
+
+            // Has ScanAhead and ScanParallel parse the top-level
+            // declarations on several threads (see ParseInParallel).
+    void SetParallelParse(bool parallel) { parallelParse = parallel; }
+
+            // Parses the source and returns the tree, or NULL if the
+            // parse failed outright.
+    Program *Parse();
+
+            // Runs the semantic checks over the tree Parse built.
+    void Check();
+
+            // Writes the source and the tree to a tree image at path.
+    void EmitAst(const char *path);
+
+            // Called by the parser (through yylex) for each token.
+    int NextToken(YYSTYPE *value, yyltype *loc);
+
+            // Called by the parser as it reduces each top-level
+            // declaration.
+    void DeclParsed(Decl *decl);
+
+            // Returns the compilation the calling thread is working on.
+    static Compilation *Current();
+
+            // Works out the line and column numbers of loc into pos and
+            // returns the compilation whose source it is in, or returns
+            // NULL (and zeros pos) if loc is in none of them.
+    static Compilation *Locate(const yyltype &loc, SourcePosition *pos);
+
+        // The state below belongs to the scanner and is used only by
+        // the routines in scanner.l and the start rule in parser.y.
+    yyscan_t scanner;
+    char *sourceText;           // whole input, followed by two NULs
+    size_t sourceLength;
+    SourceLoc sourceBase;       // location of sourceText[0]
+    uint64_t numberingEnd;      // end of the stretch of locations held
+    bool sourceMapped;          // mmap'd rather than malloc'd
+    const char *stableText;     // copy for error lines while the
+                                // scanner thread is writing sourceText
+    std::vector<unsigned int> lineStarts; // built on first request,
+    std::once_flag linesIndexed;          // just once
+    Program *program;
+    const uint32_t *astImage;   // mapped tree image holding sourceText,
+    size_t astImageLength;      // or NULL
+
+        // Holds the tree and everything else made while parsing and
+        // checking, until the compilation is destroyed.
+    Arena arena;
+
+  private:
+    struct ChunkPlan;
+    struct SlicePlan;
+
+            // Sets up a scanner on a copy of one piece of a larger
+            // source, whose first character has location base.
+    Compilation(const char *text, size_t length, SourceLoc base, bool inComment);
+
+            // Sets up a slice, to parse the given tokens of a larger
+            // source (see ParseInParallel).
+    explicit Compilation(TokenBuffer *sliceTokens);
+
+    void Register();
+    int ParseStream();
+    bool ReadBlock();
+    void EndStream();
+    void ScanAll();
+    void ScanIntoRing();
+    void ScanInParallel();
+    void ScanChunks(ChunkPlan *plan);
+    Compilation *ScanChunk(ChunkPlan *plan, int k, bool inComment);
+    int ParseInParallel();
+    void ParseSlices(SlicePlan *plan);
+    void DumpToken(int kind, YYSTYPE *value, yyltype *loc);
+
+    ScanMode scanMode;
+    int scanThreads;
+    bool dumpTokens;
+    TokenBuffer *tokens;
+    TokenRing *ring;
+    bool parallelParse;
+    std::vector<Compilation *> slices; // holding the tree's declarations
+    int streamFd;               // input being streamed, or -1
+    size_t streamCapacity;      // bytes allocated for sourceText
+    std::vector<ReportError::Message> heldChecks; // from DeclParsed
+};
+
+#endif
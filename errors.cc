@@ -8,9 +8,11 @@
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
+#include <mutex>
 using namespace std;
 
 #include "scanner.h" // for GetLineNumbered
+#include "compilation.h" // for Locate
 #include "ast_type.h"
 #include "ast_expr.h"
 #include "ast_stmt.h"
@@ -18,7 +20,13 @@ using namespace std;
 
 int ReportError::numErrors = 0;
 
-void ReportError::UnderlineErrorInLine(const char *line, yyltype *pos) {
+// Compilations on different threads share the count and stderr, so
+// each message is counted and written out whole under this lock.
+static mutex outputLock;
+
+static thread_local vector<ReportError::Message> *deferred = NULL;
+
+void ReportError::UnderlineErrorInLine(const char *line, SourcePosition *pos) {
     if (!line) return;
     cerr << line << endl;
     for (int i = 1; i <= pos->last_column; i++)
@@ -28,18 +36,52 @@ void ReportError::UnderlineErrorInLine(const char *line, yyltype *pos) {
 
  
  
+/* Function: OutputError()
+ * -------------------------
+ * Locations are only turned into line and column numbers here, when a
+ * message is actually printed (or replayed, if it was deferred).
+ */
 void ReportError::OutputError(yyltype *loc, string msg) {
+    if (deferred) {
+        Message m;
+        m.hasLoc = (loc != NULL);
+        if (loc) m.loc = *loc;
+        m.text = msg;
+        deferred->push_back(m);
+        return;
+    }
+    if (loc == NULL) {
+        PrintError(NULL, NULL, msg);
+        return;
+    }
+    SourcePosition pos;
+    Compilation *c = Compilation::Locate(*loc, &pos);
+    PrintError(&pos, GetLineNumbered(c, pos.first_line), msg);
+}
+
+void ReportError::PrintError(SourcePosition *pos, const char *line, string msg) {
+    lock_guard<mutex> hold(outputLock);
     numErrors++;
     fflush(stdout); // make sure any buffered text has been output
-    if (loc) {
-        cerr << endl << "*** Error line " << loc->first_line << "." << endl;
-        UnderlineErrorInLine(GetLineNumbered(loc->first_line), loc);
+    if (pos) {
+        cerr << endl << "*** Error line " << pos->first_line << "." << endl;
+        UnderlineErrorInLine(line, pos);
     } else
         cerr << endl << "*** Error." << endl;
     cerr << "*** " << msg << endl << endl;
 }
 
 
+void ReportError::DeferOutput(vector<Message> *list) {
+    deferred = list;
+}
+
+void ReportError::Replay(const Message &msg) {
+    yyltype loc = msg.loc;
+    OutputError(msg.hasLoc ? &loc : NULL, msg.text);
+}
+
+
 void ReportError::Formatted(yyltype *loc, const char *format, ...) {
     va_list args;
     char errbuf[2048];
@@ -55,8 +97,9 @@ void ReportError::UntermComment() {
 }
 
 void ReportError::InvalidDirective(int linenum) {
-    yyltype ll = {0, linenum, 0, 0};
-    OutputError(&ll, "Invalid # directive");
+    SourcePosition pos = {linenum, 0, linenum, 0};
+    PrintError(&pos, GetLineNumbered(Compilation::Current(), linenum),
+               "Invalid # directive");
 }
 
 void ReportError::LongIdentifier(yyltype *loc, const char *ident) {
@@ -77,10 +120,18 @@ void ReportError::UnrecogChar(yyltype *loc, char ch) {
     OutputError(loc, s.str());
 }
 
+void ReportError::IntegerOutOfRange(yyltype *loc, const char *digits) {
+    stringstream s;
+    s << "Integer constant out of range: " << digits;
+    OutputError(loc, s.str());
+}
+
 void ReportError::DeclConflict(Decl *decl, Decl *prevDecl) {
+    SourcePosition prev;
+    Compilation::Locate(*prevDecl->GetLocation(), &prev);
     stringstream s;
     s << "Declaration of '" << decl << "' here conflicts with declaration on line " 
-      << prevDecl->GetLocation()->first_line;
+      << prev.first_line;
     OutputError(decl->GetLocation(), s.str());
 }
   
@@ -96,6 +147,12 @@ void ReportError::InterfaceNotImplemented(Decl *cd, Type *interfaceType) {
     OutputError(interfaceType->GetLocation(), s.str());
 }
 
+void ReportError::InheritanceCycle(Decl *cd, Type *baseType) {
+    stringstream s;
+    s << "Class '" << cd << "' inherits from itself through '" << baseType << "'";
+    OutputError(baseType->GetLocation(), s.str());
+}
+
 void ReportError::IdentifierNotDeclared(Identifier *ident, reasonT whyNeeded) {
     stringstream s;
     static const char *names[] =  {"type", "class", "interface", "variable", "function"};
@@ -182,11 +239,12 @@ void ReportError::BreakOutsideLoop(BreakStmt *bStmt) {
  * -------------------
  * Standard error-reporting function expected by yacc. Our version merely
  * just calls into the error reporter above, passing the location of
- * the last token read. If you want to suppress the ordinary "parse error"
+ * the last token read, which the pure parser hands us along with the
+ * compilation it is working on. If you want to suppress the ordinary "parse error"
  * message from yacc, you can implement yyerror to do nothing and
  * then call ReportError::Formatted yourself with a more descriptive 
  * message.
  */
-void yyerror(const char *msg) {
-    ReportError::Formatted(&yylloc, "%s", msg);
+void yyerror(yyltype *loc, Compilation *c, const char *msg) {
+    ReportError::Formatted(loc, "%s", msg);
 }
@@ -13,6 +13,7 @@
 #define _H_errors
 
 #include <string>
+#include <vector>
 using std::string;
 #include "location.h"
 class Type;
@@ -33,7 +34,7 @@ class Operator;
  * on this class are static, thus you can invoke methods directly via
  * the class name, e.g.
  *
- *    if (missingEnd) ReportError::UntermString(&yylloc, str);
+ *    if (missingEnd) ReportError::UntermString(yylloc, str);
  *
  * For some methods, the first argument is the pointer to the location
  * structure that identifies where the problem is (usually this is the
@@ -59,12 +60,14 @@ class ReportError
   static void LongIdentifier(yyltype *loc, const char *ident);
   static void UntermString(yyltype *loc, const char *str);
   static void UnrecogChar(yyltype *loc, char ch);
+  static void IntegerOutOfRange(yyltype *loc, const char *digits);
 
   
   // Errors used by semantic analyzer for declarations
   static void DeclConflict(Decl *newDecl, Decl *prevDecl);
   static void OverrideMismatch(Decl *fnDecl);
   static void InterfaceNotImplemented(Decl *classDecl, Type *intfType);
+  static void InheritanceCycle(Decl *classDecl, Type *baseType);
 
 
   // Errors used by semantic analyzer for identifiers
@@ -104,13 +107,29 @@ class ReportError
   static void Formatted(yyltype *loc, const char *format, ...);
 
 
-  // Returns number of error messages printed
+  // Returns number of error messages printed, across all compilations
   static int NumErrors() { return numErrors; }
+
+
+  // A message held back rather than printed. When the scanner runs
+  // ahead of the parser, it defers its messages so they can be printed
+  // when the parser reaches the token they came before, in the same
+  // order as if the two were interleaved. While a list is installed by
+  // DeferOutput on a thread, messages reported on that thread are added
+  // to it (and not counted); pass NULL to go back to printing them.
+  struct Message {
+    bool hasLoc;
+    yyltype loc;
+    string text;
+  };
+  static void DeferOutput(std::vector<Message> *list);
+  static void Replay(const Message &msg);
   
  private:
 
-  static void UnderlineErrorInLine(const char *line, yyltype *pos);
+  static void UnderlineErrorInLine(const char *line, SourcePosition *pos);
   static void OutputError(yyltype *loc, string msg);
+  static void PrintError(SourcePosition *pos, const char *line, string msg);
   static int numErrors;
   
 };
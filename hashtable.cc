@@ -2,68 +2,192 @@
  * ------------------
  * Implementation of Hashtable class.
  */
-   
+
 
 /* Hashtable::Enter
  * ----------------
  * Stores new value for given identifier. If the key already
- * has an entry and flag is to overwrite, will remove previous entry first,
- * otherwise it just adds another entry under same key. Copies the
- * key, so you don't have to worry about its allocation.
+ * has an entry and flag is to overwrite, the lastmost value is replaced,
+ * otherwise it is pushed onto the key's chain of shadowed values and the
+ * new one takes its place. Interns the
+ * key, so you don't have to worry about its allocation, and entering a
+ * name that is already interned copies nothing.
  */
 template <class Value> void Hashtable<Value>::Enter(const char *key, Value val, bool overwrite)
 {
-  Value prev;
-  if (overwrite && (prev = Lookup(key)))
-    Remove(key, prev);
-  mmap.insert(std::make_pair(strdup(key), val));
+  key = Intern(key);
+  int i = Find(key);
+  if (i >= 0) {
+    Slot &slot = slots[i];
+    if (!overwrite) {
+      slot.shadowed = NewShadow(slot.value, slot.shadowed);
+      numEntries++;
+    }
+    slot.value = val;
+    return;
+  }
+  if ((numKeys + 1) * 4 > slots.size() * 3)
+    Grow();
+  Slot slot = { key, val, -1, 0 };
+  Place(slot);
+  numKeys++;
+  numEntries++;
 }
 
- 
+
 /* Hashtable::Remove
  * -----------------
  * Removes a given key-value pair from table. If no such pair, no
  * changes are made.  Does not affect any other entries under that key.
+ * If the pair was entered more than once, the earliest is the one
+ * removed, so the chain is searched from its far (oldest) end.
  */
 template <class Value> void Hashtable<Value>::Remove(const char *key, Value val)
 {
-  if (mmap.count(key) == 0) // no matches at all
+  int i = Find(key);
+  if (i < 0)
     return;
+  Slot &slot = slots[i];
+  int *oldest = NULL;
+  for (int *link = &slot.shadowed; *link >= 0; link = &shadows[*link].next)
+    if (shadows[*link].value == val)
+      oldest = link;
 
-  typename std::multimap<const char *, Value>::iterator itr;
-  itr = mmap.find(key); // start at first occurrence
-  while (itr != mmap.upper_bound(key)) {
-    if (itr->second == val) { // iterate to find matching pair
-	mmap.erase(itr);
-	break;
-    }
-    ++itr;
+  if (oldest) {
+    int k = *oldest;
+    *oldest = shadows[k].next;
+    FreeShadow(k);
+  } else if (slot.value != val) {
+    return;
+  } else if (slot.shadowed >= 0) {
+    int k = slot.shadowed;
+    slot.value = shadows[k].value;
+    slot.shadowed = shadows[k].next;
+    FreeShadow(k);
+  } else {
+    Erase(i);
+    numKeys--;
   }
-} 
+  numEntries--;
+}
 
 
 /* Hashtable::Lookup
  * -----------------
  * Returns the value earlier stored under key or NULL
- *if there is no matching entry
+ * if there is no matching entry.
+ */
+template <class Value> unsigned long Hashtable<Value>::numLookups = 0;
+
+template <class Value> Value Hashtable<Value>::Lookup(const char *key)
+{
+  numLookups++;
+  int i = Find(key);
+  return (i < 0 ? NULL : slots[i].value);
+}
+
+
+/* Hashtable::Find
+ * ---------------
+ * Returns the slot holding key, or -1. Once the search is further from
+ * key's home than the key in the slot is from its own, key would have
+ * taken that slot when it was placed, so it is not in the table.
  */
-template <class Value> Value Hashtable<Value>::Lookup(const char *key) 
+template <class Value> int Hashtable<Value>::Find(const char *key) const
 {
-  Value found = NULL;
-  
-  if (mmap.count(key) > 0) {
-    typename std::multimap<const char *, Value>::iterator cur, last, prev;
-    cur = mmap.find(key); // start at first occurrence
-    last = mmap.upper_bound(key);
-    while (cur != last) { // iterate to find last entered
-	prev = cur; 
-	if (++cur == mmap.upper_bound(key)) { // have to go one too far
-	  found = prev->second; // one before last was it
-	  break;
-	}
+  if (numKeys == 0 || key == NULL)
+    return -1;
+  size_t mask = slots.size() - 1;
+  size_t i = Home(key, mask);
+  for (unsigned int distance = 0; ; distance++, i = (i + 1) & mask) {
+    const Slot &slot = slots[i];
+    if (slot.key == key)
+      return i;
+    if (slot.key == NULL || slot.distance < distance)
+      return -1;
+  }
+}
+
+
+/* Hashtable::Place
+ * ----------------
+ * Puts a key not in the table into it, which must have room. On the way
+ * from its home slot, it swaps places with any key nearer its own home
+ * than the one being placed is, and that key is carried on instead.
+ */
+template <class Value> void Hashtable<Value>::Place(Slot slot)
+{
+  size_t mask = slots.size() - 1;
+  size_t i = Home(slot.key, mask);
+  for (slot.distance = 0; ; slot.distance++, i = (i + 1) & mask) {
+    if (slots[i].key == NULL) {
+      slots[i] = slot;
+      return;
     }
+    if (slots[i].distance < slot.distance)
+      std::swap(slots[i], slot);
+  }
+}
+
+
+/* Hashtable::Erase
+ * ----------------
+ * Empties slot i, moving each key after it that is away from home one
+ * slot back, so that Find never has to look past a hole.
+ */
+template <class Value> void Hashtable<Value>::Erase(size_t i)
+{
+  size_t mask = slots.size() - 1;
+  size_t next = (i + 1) & mask;
+  while (slots[next].key != NULL && slots[next].distance > 0) {
+    slots[i] = slots[next];
+    slots[i].distance--;
+    i = next;
+    next = (next + 1) & mask;
+  }
+  slots[i].key = NULL;
+}
+
+
+/* Hashtable::Grow
+ * ---------------
+ * Doubles the number of slots (to start with, makes a few) and places
+ * every key again. The shadowed values stay where they are.
+ */
+template <class Value> void Hashtable<Value>::Grow()
+{
+  std::vector<Slot> old;
+  old.swap(slots);
+  Slot empty = { NULL, NULL, -1, 0 };
+  slots.assign(old.empty() ? 8 : 2 * old.size(), empty);
+  for (size_t i = 0; i < old.size(); i++)
+    if (old[i].key != NULL)
+      Place(old[i]);
+}
+
+
+/* Hashtable::NewShadow, FreeShadow
+ * --------------------------------
+ * Shadowed values that are removed leave their entries on a free list
+ * for the next ones to reuse.
+ */
+template <class Value> int Hashtable<Value>::NewShadow(Value value, int next)
+{
+  Shadow shadow = { value, next };
+  if (freeShadows < 0) {
+    shadows.push_back(shadow);
+    return shadows.size() - 1;
   }
-  return found;
+  int k = freeShadows;
+  freeShadows = shadows[k].next;
+  shadows[k] = shadow;
+  return k;
+}
+
+template <class Value> void Hashtable<Value>::FreeShadow(int k)
+{
+  shadows[k].next = freeShadows;
+  freeShadows = k;
 }
 
 
@@ -72,7 +196,7 @@ template <class Value> Value Hashtable<Value>::Lookup(const char *key)
  */
 template <class Value> int Hashtable<Value>::NumEntries() const
 {
-  return mmap.size();
+  return numEntries;
 }
 
 
@@ -80,10 +204,77 @@ template <class Value> int Hashtable<Value>::NumEntries() const
 /* Hashtable:GetIterator
  * ---------------------
  * Returns iterator which can be used to walk through all values in table.
+ * The slots are in no useful order, so the keys are sorted alphabetically
+ * here, and the values under each key are given oldest first, as they
+ * were entered.
+ *
+ * The keys are sorted eight characters at a time, packed into an integer
+ * that orders them as strcmp would: a run of keys that agree on those is
+ * sorted again on the next eight. Each key's text is read once per
+ * eight characters it shares with another, rather than at every one of
+ * the sort's comparisons.
  */
-template <class Value> Iterator<Value> Hashtable<Value>::GetIterator() 
+template <class Slot> struct SortedSlot {
+  uint64_t prefix;      // eight characters of the key, first highest
+  const char *key;
+  const Slot *slot;
+};
+
+struct PrefixLessThan {
+  template <class Slot> bool operator()(const SortedSlot<Slot> &a,
+                                        const SortedSlot<Slot> &b) const
+    { return a.prefix < b.prefix; }
+};
+
+static inline uint64_t KeyPrefix(const char *key)
+{
+  uint64_t prefix = 0;
+  for (int i = 0; i < 8; i++) {
+    prefix <<= 8;
+    if (*key != '\0')
+      prefix |= (unsigned char)*key++;
+  }
+  return prefix;
+}
+
+template <class Slot> static void SortByKey(SortedSlot<Slot> *first,
+                                            SortedSlot<Slot> *last, size_t offset)
 {
-  return Iterator<Value>(mmap);
+  for (SortedSlot<Slot> *p = first; p != last; p++)
+    p->prefix = KeyPrefix(p->key + offset);
+  std::sort(first, last, PrefixLessThan());
+      // keys are distinct, so those agreeing here all go on past offset + 8
+  for (SortedSlot<Slot> *run = first; run != last; ) {
+    SortedSlot<Slot> *next = run + 1;
+    while (next != last && next->prefix == run->prefix)
+      next++;
+    if (next - run > 1)
+      SortByKey(run, next, offset + 8);
+    run = next;
+  }
+}
+
+template <class Value> Iterator<Value> Hashtable<Value>::GetIterator()
+{
+  std::vector<SortedSlot<Slot> > order;
+  order.reserve(numKeys);
+  for (size_t i = 0; i < slots.size(); i++)
+    if (slots[i].key != NULL)
+      order.push_back((SortedSlot<Slot>){0, slots[i].key, &slots[i]});
+  if (!order.empty())
+    SortByKey(&order[0], &order[0] + order.size(), 0);
+
+  Iterator<Value> iter;
+  iter.values.reserve(numEntries);
+  for (size_t i = 0; i < order.size(); i++) {
+    const Slot &slot = *order[i].slot;
+    size_t first = iter.values.size();
+    for (int k = slot.shadowed; k >= 0; k = shadows[k].next)
+      iter.values.push_back(shadows[k].value);
+    std::reverse(iter.values.begin() + first, iter.values.end());
+    iter.values.push_back(slot.value);
+  }
+  return iter;
 }
 
 
@@ -94,6 +285,6 @@ template <class Value> Iterator<Value> Hashtable<Value>::GetIterator()
  */
 template <class Value> Value Iterator<Value>::GetNextValue()
 {
-  return (cur == end ? NULL : (*cur++).second);
+  return (cur == values.size() ? NULL : values[cur++]);
 }
 
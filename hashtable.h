@@ -1,12 +1,12 @@
 /* File: hashtable.h
  * -----------------
  * This is a simple table for storing values associated with a string
- * key, supporting simple operations for Enter and Lookup.  It is not
- * much more than a thin cover over the STL associative map container,
- * but hides the awkward C++ template syntax and provides a more
- * familiar interface.
+ * key, supporting simple operations for Enter and Lookup.
  *
- * The keys are always strings, but the values can be of any type
+ * The keys are always strings, interned on entry (see intern.h) so that
+ * the table compares keys by pointer rather than with strcmp. Lookup and
+ * Remove expect an interned key, such as the name of an Identifier; any
+ * other pointer simply finds nothing. The values can be of any type
  * (ok, that's actually kind of a fib, it expects the type to be
  * some sort of pointer to conform to using NULL for "not found").
  * The typename for a Hashtable includes the value type in angle
@@ -28,30 +28,57 @@
  *               printf("%s\n", decl->GetName());
  *          }
  *       }
+ *
+ * The table is an open-addressing hash table on the key pointers, with
+ * Robin Hood insertion: a key being placed takes the slot of any key
+ * nearer its own home slot, which keeps every key close to home, so a
+ * search can stop as soon as it passes keys nearer theirs than it is.
+ * Removal shifts the keys after the removed one back, so there are no
+ * tombstones. Each key has one slot, holding its lastmost value; values
+ * it shadows are kept, newest first, in a chain in a side array. A
+ * table that nothing has been entered in allocates nothing, and the
+ * iterator sorts the keys only when it is asked for.
  */
 
 #ifndef _H_hashtable
 #define _H_hashtable
 
-#include <map>
+#include <vector>
+#include <stdint.h>
+#include <algorithm>
 #include <string.h>
-
-struct ltstr {
-  bool operator()(const char* s1, const char* s2) const
-  { return strcmp(s1, s2) < 0; }
-};
-
+#include "intern.h"
+#include "arena.h"
 
 template <class Value> class Iterator;
 
 template<class Value> class Hashtable {
 
   private: 
-     std::multimap<const char*, Value, ltstr> mmap;
+     struct Slot {
+        const char *key;        // interned, or NULL if the slot is empty
+        Value value;            // lastmost entered under key
+        int shadowed;           // in shadows, the one before, or -1
+        unsigned int distance;  // from the slot key hashes to
+     };
+     struct Shadow {
+        Value value;
+        int next;               // the one before, or -1 (or the next free)
+     };
+     std::vector<Slot> slots;   // a power of two long, or empty
+     std::vector<Shadow> shadows;
+     int freeShadows;           // list of unused shadows, or -1
+     int numKeys, numEntries;
  
    public:
             // ctor creates a new empty hashtable
-     Hashtable() {}
+     Hashtable() : freeShadows(-1), numKeys(0), numEntries(0) {}
+
+           // Tables are allocated from the current compilation's arena,
+           // which destroys them when it is released.
+     static void *operator new(size_t size)
+        { return ArenaAllocate(size, Destroy); }
+     static void operator delete(void *p) {}
 
            // Returns number of entries currently in table
      int NumEntries() const;
@@ -71,7 +98,7 @@ template<class Value> class Hashtable {
            // entirely.
      void Remove(const char *key, Value value);
 
-          // Returns value stored under key or NULL if no match.
+          // Returns value stored under interned key or NULL if no match.
           // If more than one value for key (ie shadow feature was
           // used during Enter), returns the lastmost entered one.
      Value Lookup(const char *key);
@@ -80,6 +107,25 @@ template<class Value> class Hashtable {
           // visit each value in the table in alphabetical order.
      Iterator<Value> GetIterator();
 
+          // Returns how many lookups all tables of this type have made,
+          // for the "stats" debug key. They are counted without a lock,
+          // so the count is exact only while one thread uses tables.
+     static unsigned long NumLookups() { return numLookups; }
+
+  private:
+     static unsigned long numLookups;
+
+     static void Destroy(void *p)
+        { ((Hashtable *)p)->~Hashtable(); }
+
+     static size_t Home(const char *key, size_t mask)
+        { return (size_t)(((uint64_t)(uintptr_t)key * 0x9E3779B97F4A7C15ull) >> 32) & mask; }
+     int Find(const char *key) const;
+     void Place(Slot slot);
+     void Erase(size_t i);
+     void Grow();
+     int NewShadow(Value value, int next);
+     void FreeShadow(int k);
 };
 
 
@@ -91,9 +137,9 @@ template<class Value> class Iterator {
   friend class Hashtable<Value>;
 
   private:
-    typename std::multimap<const char*, Value , ltstr>::iterator cur, end;
-    Iterator(std::multimap<const char*, Value, ltstr>& t)
-      : cur(t.begin()), end(t.end()) {}
+    std::vector<Value> values;
+    int cur;
+    Iterator() : cur(0) {}
 
   public:
          // Returns current value and advances iterator to next.
@@ -0,0 +1,156 @@
+/* File: intern.cc
+ * ---------------
+ * Implementation of the intern table. The characters of interned names
+ * are packed one after another into large blocks, so interning a new
+ * name does not cost an allocation of its own. The table is split into
+ * shards chosen by the top bits of the hash, each an array of slots
+ * indexed by hash and probed linearly, kept at most half full. Each
+ * shard has its own lock, so scanners running on several threads at
+ * once rarely wait for one another.
+ */
+
+#include "intern.h"
+#include "utility.h"
+#include <string.h>
+#include <stdlib.h>
+#include <mutex>
+
+struct Slot {
+  const char *str;      // NULL marks an empty slot
+  unsigned int hash;
+};
+
+// The initializers make the shards constant-initialized, so they are
+// ready before any static constructor (Type's, say) interns a name.
+struct Shard {
+  std::mutex lock;
+  Slot *slots = NULL;
+  int capacity = 0;     // always zero or a power of two
+  int numEntries = 0;
+  char *block = NULL;   // unused tail of current character block
+  int blockLeft = 0;
+};
+
+static const int ShardBits = 6;
+static Shard shards[1 << ShardBits];
+
+static const int InitialCapacity = 64;
+static const int BlockSize = 16*1024;
+
+
+/* Function: Hash()
+ * ----------------
+ * FNV-1a over the len characters of str.
+ */
+static unsigned int Hash(const char *str, int len)
+{
+  unsigned int h = 2166136261u;
+  for (int i = 0; i < len; i++)
+    h = (h ^ (unsigned char)str[i]) * 16777619u;
+  return h;
+}
+
+static Shard *ShardFor(unsigned int hash)
+{
+  return &shards[hash >> (32 - ShardBits)];
+}
+
+/* Function: Store()
+ * -----------------
+ * Copies len characters plus a terminating NUL into the shard's current
+ * block, starting a new block when this one does not have room.
+ */
+static const char *Store(Shard *s, const char *str, int len)
+{
+  if (len + 1 > s->blockLeft) {
+    s->blockLeft = (len + 1 > BlockSize ? len + 1 : BlockSize);
+    if ((s->block = (char *)malloc(s->blockLeft)) == NULL)
+      Failure("Out of memory interning names");
+  }
+  char *copy = s->block;
+  memcpy(copy, str, len);
+  copy[len] = '\0';
+  s->block += len + 1;
+  s->blockLeft -= len + 1;
+  return copy;
+}
+
+/* Function: Grow()
+ * ----------------
+ * Doubles the shard's slot array and re-inserts the existing entries.
+ * The stored hashes mean no string needs to be looked at again.
+ */
+static void Grow(Shard *s)
+{
+  Slot *old = s->slots;
+  int oldCapacity = s->capacity;
+
+  s->capacity = (s->capacity ? s->capacity*2 : InitialCapacity);
+  if ((s->slots = (Slot *)calloc(s->capacity, sizeof(Slot))) == NULL)
+    Failure("Out of memory interning names");
+  for (int i = 0; i < oldCapacity; i++) {
+    if (old[i].str == NULL) continue;
+    int j = old[i].hash & (s->capacity - 1);
+    while (s->slots[j].str != NULL)
+      j = (j + 1) & (s->capacity - 1);
+    s->slots[j] = old[i];
+  }
+  free(old);
+}
+
+/* Function: Probe()
+ * -----------------
+ * Returns the slot holding the given spelling, or else the empty slot
+ * where it would be entered.
+ */
+static Slot *Probe(Shard *s, const char *str, int len, unsigned int hash)
+{
+  int i = hash & (s->capacity - 1);
+  while (s->slots[i].str != NULL) {
+    if (s->slots[i].hash == hash && !strncmp(s->slots[i].str, str, len)
+        && s->slots[i].str[len] == '\0')
+      return &s->slots[i];
+    i = (i + 1) & (s->capacity - 1);
+  }
+  return &s->slots[i];
+}
+
+
+const char *Intern(const char *str, int len)
+{
+  Assert(str != NULL && len >= 0);
+  unsigned int hash = Hash(str, len);
+  Shard *s = ShardFor(hash);
+  std::lock_guard<std::mutex> hold(s->lock);
+  if (s->capacity == 0) Grow(s);
+
+  Slot *slot = Probe(s, str, len, hash);
+  if (slot->str != NULL)
+    return slot->str;
+
+  if (2*(s->numEntries + 1) > s->capacity) {
+    Grow(s);
+    slot = Probe(s, str, len, hash);
+  }
+  slot->str = Store(s, str, len);
+  slot->hash = hash;
+  s->numEntries++;
+  return slot->str;
+}
+
+const char *Intern(const char *str)
+{
+  Assert(str != NULL);
+  return Intern(str, strlen(str));
+}
+
+const char *FindInterned(const char *str)
+{
+  Assert(str != NULL);
+  int len = strlen(str);
+  unsigned int hash = Hash(str, len);
+  Shard *s = ShardFor(hash);
+  std::lock_guard<std::mutex> hold(s->lock);
+  if (s->capacity == 0) return NULL;
+  return Probe(s, str, len, hash)->str;
+}
@@ -0,0 +1,42 @@
+/* File: intern.h
+ * --------------
+ * The intern table keeps exactly one copy of each distinct name spelling.
+ * The scanner interns every identifier as it is matched, and the AST and
+ * the symbol tables hang on to the interned pointer from then on, so two
+ * names are the same name exactly when their pointers are equal and no
+ * further copies or strcmp calls are needed. String constants are
+ * interned the same way (quotes and all, so they cannot be mistaken for
+ * names), which gives identical constants one shared copy and no
+ * allocation of their own.
+ *
+ * Interned strings are NUL-terminated, are never moved and live until
+ * the program exits. The table is shared by every compilation and is
+ * safe to use from several threads at once. Sample usage:
+ *
+ *       const char *a = Intern("main"), *b = Intern(yytext, yyleng);
+ *       if (a == b) ...   // same spelling
+ */
+
+#ifndef _H_intern
+#define _H_intern
+
+
+/* Function: Intern()
+ * ------------------
+ * Returns the interned copy of the string, entering it in the table the
+ * first time a spelling is seen. The two-argument form interns the first
+ * len characters of str, which need not be NUL-terminated.
+ */
+const char *Intern(const char *str);
+const char *Intern(const char *str, int len);
+
+
+/* Function: FindInterned()
+ * ------------------------
+ * Returns the interned copy of the string if it has been interned before,
+ * or NULL if not. Never adds to the table, so it is the one to use when
+ * the string is only being looked up.
+ */
+const char *FindInterned(const char *str);
+
+#endif
@@ -30,6 +30,7 @@
 
 #include <deque>
 #include "utility.h"  // for Assert()
+#include "arena.h"    // for ArenaAllocate()
   
 class Node;
 
@@ -42,6 +43,12 @@ template<class Element> class List {
            // Create a new empty list
     List() {}
 
+           // Lists are allocated from the current compilation's arena,
+           // which destroys them when it is released.
+    static void *operator new(size_t size)
+	{ return ArenaAllocate(size, Destroy); }
+    static void operator delete(void *p) {}
+
            // Returns count of elements currently in list
     int NumElements() const
 	{ return elems.size(); }
@@ -77,6 +84,9 @@ template<class Element> class List {
         { for (int i = 0; i < NumElements(); i++)
              Nth(i)->SetParent(p); }
 
+ private:
+    static void Destroy(void *p)
+	{ ((List *)p)->~List(); }
 };
 
 #endif
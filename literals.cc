@@ -0,0 +1,54 @@
+/* File: literals.cc
+ * -----------------
+ * Implementation of the numeric constant decoders, using std::from_chars.
+ * Unlike strtol and atof, from_chars ignores the locale, needs no NUL
+ * at the end, never allocates, and reports overflow in its result
+ * rather than through errno.
+ */
+
+#include "literals.h"
+#include <charconv>
+#include <limits.h>
+#include <stdlib.h>   // for strtod
+#include <string>
+
+
+bool DecodeInteger(const char *p, const char *end, int *value)
+{
+  unsigned int n;
+  std::from_chars_result r = std::from_chars(p, end, n, 10);
+  if (r.ec == std::errc() && n <= INT_MAX) {
+    *value = n;
+    return true;
+  }
+  *value = INT_MAX;
+  return false;
+}
+
+bool DecodeHexInteger(const char *p, const char *end, int *value)
+{
+  unsigned int n;
+  std::from_chars_result r = std::from_chars(p + 2, end, n, 16);  // past 0x
+  if (r.ec == std::errc()) {
+    *value = (int)n;
+    return true;
+  }
+  *value = INT_MAX;
+  return false;
+}
+
+/* Function: DecodeDouble()
+ * ------------------------
+ * from_chars leaves the value alone when it is out of range, so those
+ * (rare) constants go through strtod, which gives infinity or zero.
+ * The scanner never changes the locale, so strtod's decimal point is
+ * the usual one.
+ */
+double DecodeDouble(const char *p, const char *end)
+{
+  double d;
+  std::from_chars_result r = std::from_chars(p, end, d);
+  if (r.ec == std::errc())
+    return d;
+  return strtod(std::string(p, end).c_str(), NULL);
+}
@@ -0,0 +1,43 @@
+/* File: literals.h
+ * ----------------
+ * Routines the scanner uses to turn the text of a numeric constant into
+ * its value. They work straight from the matched characters in the
+ * scanner's buffer, without the locale handling and second pass over
+ * the text that strtol and atof do, and they tell the scanner when an
+ * integer constant does not fit in a Decaf int.
+ *
+ * Each routine works on the half-open range [p, end), which must hold
+ * text already matched by the corresponding pattern in scanner.l.
+ */
+
+#ifndef _H_literals
+#define _H_literals
+
+
+/* Function: DecodeInteger()
+ * -------------------------
+ * Sets *value to the decimal integer in the range and returns true, or
+ * returns false if it is larger than the largest int (*value is then
+ * set to that). Negative constants are written with unary minus, so
+ * there is no sign to handle here.
+ */
+bool DecodeInteger(const char *p, const char *end, int *value);
+
+
+/* Function: DecodeHexInteger()
+ * ----------------------------
+ * As DecodeInteger for a hex constant, 0x included. Hex constants give a
+ * bit pattern, so anything up to 0xFFFFFFFF fits (0xFFFFFFFF being -1).
+ */
+bool DecodeHexInteger(const char *p, const char *end, int *value);
+
+
+/* Function: DecodeDouble()
+ * ------------------------
+ * Returns the value of the double constant in the range, rounded to
+ * nearest. Constants too large give infinity and ones too small give
+ * zero, as atof would.
+ */
+double DecodeDouble(const char *p, const char *end);
+
+#endif
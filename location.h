@@ -2,35 +2,64 @@
  * ----------------
  * This file just contains features relative to the location structure
  * used to record the lexical position of a token or symbol.  This file
- * establishes the cmoon definition for the yyltype structure, the global
- * variable yylloc, and a utility function to join locations you might
- * find handy at times.
+ * establishes the cmoon definition for the yyltype structure and a
+ * utility function to join locations you might find handy at times.
+ * There is no global yylloc: the pure parser keeps the location of the
+ * lookahead in yyparse and passes the scanner a pointer to fill in.
  */
 
 #ifndef YYLTYPE
 
+#include <stdint.h>
+
+/* Typedef: SourceLoc
+ * ------------------
+ * A position in the source as a 32-bit handle. Every compilation's text
+ * is given a stretch of one numbering shared by all compilations,
+ * starting at the compilation's sourceBase, so the handle says both
+ * which file it is in and the byte offset within that file. Line and
+ * column are only worked out from it when needed, which is when an
+ * error is printed (see Compilation::Locate). 0 means no position.
+ */
+typedef uint32_t SourceLoc;
+
+
 /* Typedef: yyltype
  * ----------------
  * Defines the struct type that is used by the scanner to store
- * position information about each lexeme scanned.
+ * position information about each lexeme scanned: the positions of its
+ * first and last characters. The same type serves for the span of any
+ * construct, from its first token to its last.
  */
 typedef struct yyltype
 {
-    int timestamp;                 // you can ignore this field
-    int first_line, first_column;
-    int last_line, last_column;      
-    char *text;                    // you can also ignore this field
+    SourceLoc first, last;
 } yyltype;
 
 #define YYLTYPE yyltype
 
+// How the parser works out the location of a rule from those of its
+// parts; an empty rule sits just after whatever came before it.
+#define YYLLOC_DEFAULT(Cur, Rhs, N)                             \
+    do {                                                        \
+        if (N) {                                                \
+            (Cur).first = YYRHSLOC(Rhs, 1).first;               \
+            (Cur).last = YYRHSLOC(Rhs, N).last;                 \
+        } else                                                  \
+            (Cur).first = (Cur).last = YYRHSLOC(Rhs, 0).last;   \
+    } while (0)
 
-/* Global variable: yylloc
- * ------------------------
- * The global variable holding the position information about the
- * lexeme just scanned.
+
+/* Typedef: SourcePosition
+ * -----------------------
+ * A location worked out into line and column numbers, for printing.
+ * Columns count from 1, with tabs advancing to the next tab stop.
  */
-extern struct yyltype yylloc;
+typedef struct SourcePosition
+{
+    int first_line, first_column;
+    int last_line, last_column;
+} SourcePosition;
 
 
 /* Function: Join
@@ -41,10 +70,8 @@ extern struct yyltype yylloc;
 inline yyltype Join(yyltype first, yyltype last)
 {
   yyltype combined;
-  combined.first_column = first.first_column;
-  combined.first_line = first.first_line;
-  combined.last_column = last.last_column;
-  combined.last_line = last.last_line;
+  combined.first = first.first;
+  combined.last = last.last;
   return combined;
 }
 
@@ -56,4 +83,3 @@ inline yyltype Join(yyltype *firstPtr, yyltype *lastPtr)
 
 
 #endif
-
@@ -9,23 +9,71 @@
 #include "utility.h"
 #include "errors.h"
 #include "parser.h"
+#include "compilation.h"
+
+
+/* Function: GetScanMode()
+ * ------------------------
+ * The -scan option picks how the scanner feeds the parser: on demand
+ * (the default), "ahead" to scan the whole file first, "thread" to
+ * scan on a second thread, or "parallel" to scan the whole file first
+ * in pieces on several threads (as many as -threads gives, or one per
+ * processor), or "stream" to read the input a block at a time as it
+ * arrives and parse each block before reading the next.
+ */
+static Compilation::ScanMode GetScanMode()
+{
+    const char *mode = GetOption("scan");
+    if (mode == NULL || !strcmp(mode, "demand"))
+        return Compilation::ScanOnDemand;
+    if (!strcmp(mode, "ahead"))
+        return Compilation::ScanAhead;
+    if (!strcmp(mode, "thread"))
+        return Compilation::ScanOnThread;
+    if (!strcmp(mode, "parallel"))
+        return Compilation::ScanParallel;
+    if (!strcmp(mode, "stream"))
+        return Compilation::ScanStream;
+    printf("Unknown scan mode: %s (expected demand, ahead, thread, parallel or stream)\n", mode);
+    exit(2);
+}
 
 
 /* Function: main()
  * ----------------
  * Entry point to the entire program.  We parse the command line and turn
  * on any debugging flags requested by the user when invoking the program.
- * InitScanner() is used to set up the scanner.
- * InitParser() is used to set up the parser. The call to yyparse() will
- * attempt to parse a complete program from the input. 
+ * InitParser() is used to set up the parser. The Compilation sets up a
+ * scanner on standard input, and Parse() will attempt to parse a complete
+ * program from it. If that goes cleanly, we kick off the semantic
+ * analyzer pass on the tree.
+ *
+ * With -load-ast=<file> the tree comes from an image saved by an
+ * earlier run instead of from standard input, and with -emit-ast=<file>
+ * a tree that parsed and checked cleanly is saved to such an image.
+ * With -scan=ahead or -scan=parallel, -parse=parallel also splits the
+ * parse over the threads.
  */
 int main(int argc, char *argv[])
 {
     ParseCommandLine(argc, argv);
   
-    InitScanner();
     InitParser();
-    yyparse();
+    Compilation *compilation;
+    if (GetOption("load-ast"))
+        compilation = new Compilation(GetOption("load-ast"));
+    else
+        compilation = new Compilation(stdin, GetScanMode());
+    if (GetOption("threads"))
+        compilation->SetScanThreads(atoi(GetOption("threads")));
+    if (GetOption("parse") && !strcmp(GetOption("parse"), "parallel"))
+        compilation->SetParallelParse(true);
+    Program *program = compilation->Parse();
+    if (program && ReportError::NumErrors() == 0)
+        compilation->Check();
+    if (program && ReportError::NumErrors() == 0 && GetOption("emit-ast"))
+        compilation->EmitAst(GetOption("emit-ast"));
+    delete compilation;
     return (ReportError::NumErrors() == 0? 0 : -1);
 }
 
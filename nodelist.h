@@ -0,0 +1,126 @@
+/* File: nodelist.h
+ * ----------------
+ * The lists of children held by tree nodes (the members of a class, the
+ * formals of a function, the statements of a block, the actuals of a
+ * call and so on) are nearly always short and never change once the
+ * node is built. Rather than a general List with a deque behind it,
+ * they use the two classes here, both allocated from the compilation's
+ * arena (see arena.h):
+ *
+ * A SmallList is what the parser collects children in. It has room for
+ * a few elements inside itself, and only beyond that takes a separate
+ * array from the arena, doubling it as needed.
+ *
+ * A NodeList is the finished list a node keeps: a count followed by
+ * exactly that many elements, all in one block of the arena. It is
+ * made from a SmallList by Freeze, once the list is complete.
+ *
+ * Sample usage, in the parser:
+ *
+ *      ($$ = new SmallList<Stmt*>)->Append($1);
+ *      ...
+ *      $$ = new StmtBlock($2->Freeze(), $3->Freeze());
+ *
+ * and in a node:
+ *
+ *      for (int i = 0; i < stmts->NumElements(); i++)
+ *          stmts->Nth(i)->Check();
+ *
+ * Elements are copied as plain bytes and never destroyed, so they
+ * should be pointers (or other types that need no destructor).
+ */
+
+#ifndef _H_nodelist
+#define _H_nodelist
+
+#include <stddef.h>  // for offsetof
+#include <string.h>  // for memcpy
+#include <new>       // for placement new
+#include "utility.h" // for Assert()
+#include "arena.h"   // for ArenaAllocate()
+
+class Node;
+template<class Element> class SmallList;
+
+
+template<class Element> class NodeList {
+
+ private:
+    int numElements;
+    Element elems[1];   // in fact numElements long, see Freeze
+
+    NodeList() {}
+    friend class SmallList<Element>;
+
+ public:
+          // Returns count of elements in list
+    int NumElements() const
+	{ return numElements; }
+
+          // Returns element at index in list. Indexing is 0-based.
+          // Raises an assert if index is out of range.
+    Element Nth(int index) const
+	{ Assert(index >= 0 && index < numElements);
+	  return elems[index]; }
+
+          // Sets the parent of every element, as List::SetParentAll.
+    void SetParentAll(Node *p)
+        { for (int i = 0; i < numElements; i++)
+             elems[i]->SetParent(p); }
+};
+
+
+template<class Element> class SmallList {
+
+ private:
+    static const int InlineCapacity = 4;
+
+    int numElements, capacity;
+    Element *elems;                  // inlineElems until it outgrows them
+    Element inlineElems[InlineCapacity];
+
+ public:
+           // Create a new empty list
+    SmallList() : numElements(0), capacity(InlineCapacity), elems(inlineElems) {}
+
+           // Lists are allocated from the current compilation's arena
+           // and need no destructor.
+    static void *operator new(size_t size) { return ArenaAllocate(size); }
+    static void operator delete(void *p) {}
+
+           // Returns count of elements currently in list
+    int NumElements() const
+	{ return numElements; }
+
+          // Adds element to list end
+    void Append(const Element &elem)
+	{ if (numElements == capacity) Grow();
+	  elems[numElements++] = elem; }
+
+          // Reverses the order of the elements, for lists that the
+          // parser builds back to front. Returns the list.
+    SmallList *Reverse()
+	{ for (int i = 0, j = numElements - 1; i < j; i++, j--) {
+	      Element tmp = elems[i]; elems[i] = elems[j]; elems[j] = tmp;
+	  }
+	  return this; }
+
+          // Returns a NodeList holding the elements in one block of the
+          // arena. The SmallList is left as it was.
+    NodeList<Element> *Freeze() const
+	{ size_t size = offsetof(NodeList<Element>, elems) + numElements * sizeof(Element);
+	  if (size < sizeof(NodeList<Element>)) size = sizeof(NodeList<Element>);
+	  NodeList<Element> *list = new (ArenaAllocate(size)) NodeList<Element>;
+	  list->numElements = numElements;
+	  memcpy(list->elems, elems, numElements * sizeof(Element));
+	  return list; }
+
+ private:
+    void Grow()
+	{ Element *bigger = (Element *)ArenaAllocate(2 * capacity * sizeof(Element));
+	  memcpy(bigger, elems, numElements * sizeof(Element));
+	  elems = bigger;
+	  capacity *= 2; }
+};
+
+#endif
@@ -11,7 +11,7 @@
   // (types, classes, constants, etc.)
   
 #include "scanner.h"            // for MaxIdentLen
-#include "list.h"       	// because we use all these types
+#include "nodelist.h"   	// because we use all these types
 #include "ast.h"		// in the union, we need their declarations
 #include "ast_type.h"
 #include "ast_decl.h"
@@ -30,9 +30,11 @@
 
 #ifndef YYBISON                 
 #include "y.tab.h"              
+int ScanToken(YYSTYPE *lvalp, YYLTYPE *llocp, yyscan_t scanner); // Defined in scanner.l
 #endif
 
-int yyparse();              // Defined in the generated y.tab.c file
+class Compilation;
+int yyparse(Compilation *c); // Defined in the generated y.tab.c file
 void InitParser();          // Defined in parser.y
 
 #endif
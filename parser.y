@@ -4,21 +4,70 @@
  *
  * pp3: add parser rules and tree construction from your pp2. You should
  *      not need to make any significant changes in the parser itself. After
- *      parsing completes, if no syntax errors were found, the parser calls
- *      program->Check() to kick off the semantic analyzer pass. The
- *      interesting work happens during the tree traversal.
+ *      parsing completes, the parser leaves the finished tree in the
+ *      compilation it was run for, and if no syntax errors were found,
+ *      main calls program->Check() to kick off the semantic analyzer pass.
+ *      The interesting work happens during the tree traversal.
+ *
+ * The parser is pure: yylval and yylloc are locals of yyparse, and the
+ * compilation is passed through to each yylex call, so any number of
+ * compilations can be parsed at once. yylex (in compilation.cc) gets
+ * the next token from the scanner or from tokens it scanned ahead.
+ *
+ * Bison also builds a push parser from the same grammar (yypstate_new
+ * and yypush_parse), which the compilation feeds a token at a time when
+ * it streams its input rather than reading it first. Each top-level
+ * declaration is passed to the compilation as soon as it is reduced,
+ * so that it can be checked before the rest of the input has arrived.
  */
 
 %{
 
-#include "scanner.h" // for yylex
+#include "compilation.h"
 #include "parser.h"
 #include "errors.h"
 
-void yyerror(const char *msg); // standard error-handling routine
-
 %}
 
+%define api.pure full
+%define api.push-pull both
+%locations
+%parse-param { Compilation *compilation }
+%lex-param   { Compilation *compilation }
+
+%code {
+int yylex(YYSTYPE *lvalp, YYLTYPE *llocp, Compilation *c); // from compilation.cc
+void yyerror(YYLTYPE *llocp, Compilation *c, const char *msg); // standard error-handling routine
+
+/* Macro: yyoverflow
+ * -----------------
+ * The parser's stacks start out in yyparse's frame (or in the push
+ * parser's state). Bison will only move them to the heap by itself in
+ * C++ if told the location type is one of its own, which ours is not,
+ * and otherwise gives up at a couple of hundred levels of nesting. So
+ * they are moved here instead, into the compilation's arena and twice
+ * as big each time they fill, which leaves the nesting limited only by
+ * memory.
+ */
+template<class T> static T *GrowStack(T *stack, size_t bytesUsed, size_t newSize)
+{
+    T *bigger = (T *)ArenaAllocate(newSize * sizeof(T));
+    memcpy(bigger, stack, bytesUsed);
+    return bigger;
+}
+
+#define yyoverflow(Msg, SS, SSBytes, VS, VSBytes, LS, LSBytes, Size)  \
+    (*(Size) *= 2,                                                    \
+     *(SS) = GrowStack(*(SS), SSBytes, *(Size)),                      \
+     *(VS) = GrowStack(*(VS), VSBytes, *(Size)),                      \
+     *(LS) = GrowStack(*(LS), LSBytes, *(Size)))
+
+// Defining yyoverflow also leaves out bison's own choice of these,
+// which the push parser still needs for its state.
+#define YYMALLOC malloc
+#define YYFREE free
+}
+
  
 /* yylval 
  * ------
@@ -26,11 +75,22 @@ void yyerror(const char *msg); // standard error-handling routine
 %union {
     int integerConstant;
     bool boolConstant;
-    char *stringConstant;
+    const char *stringConstant;
     double doubleConstant;
-    char identifier[MaxIdentLen+1]; // +1 for terminating null
+    const char *identifier; // interned, see intern.h
     Decl *decl;
-    List<Decl*> *declList;
+    SmallList<Decl*> *declList;
+    Type *type;
+    NamedType *cType;
+    SmallList<NamedType*> *cTypeList;
+    FnDecl *fDecl;
+    VarDecl *var;
+    SmallList<VarDecl*> *varList;
+    Expr *expr;
+    SmallList<Expr*> *exprList;
+    Stmt *stmt;
+    SmallList<Stmt*> *stmtList;
+    LValue *lvalue;
 }
 
 
@@ -50,29 +110,246 @@ void yyerror(const char *msg); // standard error-handling routine
 %token   <boolConstant> T_BoolConstant
 
 
+/* Precedence and associativity
+ * ------------------------------
+ * Listed from lowest to highest. T_Lower_Than_Else and T_UnaryMinus
+ * are placeholders used with %prec to resolve the dangling else and
+ * to give unary minus its own precedence.
+ */
+%right    '='
+%left     T_Or
+%left     T_And
+%nonassoc T_Equal T_NotEqual
+%nonassoc '<' '>' T_LessEqual T_GreaterEqual
+%left     '+' '-'
+%left     '*' '/' '%'
+%right    '!' T_UnaryMinus
+%left     '.' '['
+%nonassoc T_Lower_Than_Else
+%nonassoc T_Else
+
+
 /* Non-terminal types
  * ------------------
  */
-%type <declList>  DeclList 
+%type <declList>  DeclList IntfList FieldList
+%type <decl>      Decl ClassDecl IntfDecl Field
+%type <var>       VarDecl Variable
+%type <varList>   Formals FormalList VarDecls
+%type <fDecl>     FnHeader FnDecl
+%type <type>      Type
+%type <cType>     OptExt
+%type <cTypeList> OptImpl ImpList
+%type <stmt>      StmtBlock Stmt OptElse
+%type <stmtList>  StmtList
+%type <lvalue>    LValue
+%type <expr>      Expr OptExpr Call Constant
+%type <exprList>  Actuals ExprList
 
 %%
 /* Rules
  * -----
-	 
+ * All productions and actions should be placed between the start and stop
+ * %% markers which delimit the Rules section.
  */
-Program   :    DeclList            { 
-                                      @1; 
-                                      Program *program = new Program($1);
-                                      // if no errors, advance to next phase
-                                      if (ReportError::NumErrors() == 0) 
-                                          program->Check(); 
+Program   :    DeclList                       { 
+                                      compilation->program = new Program($1->Freeze());
                                     }
           ;
 
-DeclList  :            { /* replace with your parser */ }
+DeclList  :    DeclList Decl
+               { ($$=$1)->Append($2); compilation->DeclParsed($2); }
+          |    Decl
+               { ($$ = new SmallList<Decl*>)->Append($1); compilation->DeclParsed($1); }
+          ;
+
+Decl      :    ClassDecl
+          |    FnDecl                         { $$=$1; }
+          |    VarDecl                        { $$=$1; }
+          |    IntfDecl
           ;
 
+VarDecl   :    Variable ';'
+          ;
 
+Variable  :    Type T_Identifier
+               { $$ = new VarDecl(new Identifier(@2, $2), $1); }
+          ;
+
+Type      :    T_Int                          { $$ = Type::intType; }
+          |    T_Bool                         { $$ = Type::boolType; }
+          |    T_String                       { $$ = Type::stringType; }
+          |    T_Double                       { $$ = Type::doubleType; }
+          |    T_Identifier
+               { $$ = new NamedType(new Identifier(@1,$1)); }
+          |    Type T_Dims
+               { $$ = new ArrayType(Join(@1, @2), $1); }
+          ;
+
+IntfDecl  :    T_Interface T_Identifier '{' IntfList '}'
+               { $$ = new InterfaceDecl(new Identifier(@2, $2), $4->Freeze()); }
+          ;
+
+IntfList  :    IntfList FnHeader ';'          { ($$=$1)->Append($2); }
+          |    /* empty */                    { $$ = new SmallList<Decl*>(); }
+          ;
+
+ClassDecl :    T_Class T_Identifier OptExt OptImpl '{' FieldList '}'
+               { $$ = new ClassDecl(new Identifier(@2, $2), $3, $4->Freeze(), $6->Freeze()); }
+          ;
+
+OptExt    :    T_Extends T_Identifier
+               { $$ = new NamedType(new Identifier(@2, $2)); }
+          |    /* empty */                    { $$ = NULL; }
+          ;
+
+OptImpl   :    T_Implements ImpList           { $$ = $2; }
+          |    /* empty */                    { $$ = new SmallList<NamedType*>; }
+          ;
+
+ImpList   :    ImpList ',' T_Identifier
+               { ($$=$1)->Append(new NamedType(new Identifier(@3, $3))); }
+          |    T_Identifier
+               { ($$=new SmallList<NamedType*>)->Append(new NamedType(new Identifier(@1, $1))); }
+          ;
+
+FieldList :    FieldList Field                { ($$=$1)->Append($2); }
+          |    /* empty */                    { $$ = new SmallList<Decl*>(); }
+          ;
+
+Field     :    VarDecl                        { $$ = $1; }
+          |    FnDecl                         { $$ = $1; }
+          ;
+
+FnHeader  :    Type T_Identifier '(' Formals ')'
+               { $$ = new FnDecl(new Identifier(@2, $2), $1, $4->Freeze()); }
+          |    T_Void T_Identifier '(' Formals ')'
+               { $$ = new FnDecl(new Identifier(@2, $2), Type::voidType, $4->Freeze()); }
+          ;
+
+Formals   :    FormalList                     { $$ = $1; }
+          |    /* empty */                    { $$ = new SmallList<VarDecl*>; }
+          ;
+
+FormalList:    FormalList ',' Variable        { ($$=$1)->Append($3); }
+          |    Variable
+               { ($$ = new SmallList<VarDecl*>)->Append($1); }
+          ;
+
+FnDecl    :    FnHeader StmtBlock             { ($$=$1)->SetFunctionBody($2); }
+          ;
+
+StmtBlock :    '{' VarDecls StmtList '}'
+               { $$ = new StmtBlock($2->Freeze(), $3->Reverse()->Freeze()); }
+          ;
+
+VarDecls  :    VarDecls VarDecl               { ($$=$1)->Append($2); }
+          |    /* empty */                    { $$ = new SmallList<VarDecl*>; }
+          ;
+
+StmtList  :    Stmt StmtList                  { ($$=$2)->Append($1); } /* back to front */
+          |    /* empty */                    { $$ = new SmallList<Stmt*>; }
+          ;
+
+Stmt      :    OptExpr ';'                    { $$ = $1; }
+          |    StmtBlock
+          |    T_If '(' Expr ')' Stmt OptElse { $$ = new IfStmt($3, $5, $6); }
+          |    T_While '(' Expr ')' Stmt      { $$ = new WhileStmt($3, $5); }
+          |    T_For '(' OptExpr ';' Expr ';' OptExpr ')' Stmt
+               { $$ = new ForStmt($3, $5, $7, $9); }
+          |    T_Return Expr ';'              { $$ = new ReturnStmt(@2, $2); }
+          |    T_Return ';'
+               { $$ = new ReturnStmt(@1, new EmptyExpr()); }
+          |    T_Print '(' ExprList ')' ';'   { $$ = new PrintStmt($3->Freeze()); }
+          |    T_Break ';'                    { $$ = new BreakStmt(@1); }
+          ;
+
+LValue    :    T_Identifier
+               { $$ = new FieldAccess(NULL, new Identifier(@1, $1)); }
+          |    Expr '.' T_Identifier
+               { $$ = new FieldAccess($1, new Identifier(@3, $3)); }
+          |    Expr '[' Expr ']'
+               { $$ = new ArrayAccess(Join(@1, @4), $1, $3); }
+          ;
+
+Call      :    T_Identifier '(' Actuals ')'
+               { $$ = new Call(Join(@1,@4), NULL, new Identifier(@1,$1), $3->Freeze()); }
+          |    Expr '.' T_Identifier '(' Actuals ')'
+               { $$ = new Call(Join(@1,@6), $1, new Identifier(@3,$3), $5->Freeze()); }
+          ;
+
+OptExpr   :    Expr                           { $$ = $1; }
+          |    /* empty */                    { $$ = new EmptyExpr(); }
+          ;
+
+Expr      :    LValue                         { $$ = $1; }
+          |    Call
+          |    Constant
+          |    LValue '=' Expr
+               { $$ = new AssignExpr($1, new Operator(@2,"="), $3); }
+          |    Expr '+' Expr
+               { $$ = new ArithmeticExpr($1, new Operator(@2, "+"), $3); }
+          |    Expr '-' Expr
+               { $$ = new ArithmeticExpr($1, new Operator(@2, "-"), $3); }
+          |    Expr '/' Expr
+               { $$ = new ArithmeticExpr($1, new Operator(@2,"/"), $3); }
+          |    Expr '*' Expr
+               { $$ = new ArithmeticExpr($1, new Operator(@2,"*"), $3); }
+          |    Expr '%' Expr
+               { $$ = new ArithmeticExpr($1, new Operator(@2,"%"), $3); }
+          |    Expr T_Equal Expr
+               { $$ = new EqualityExpr($1, new Operator(@2,"=="), $3); }
+          |    Expr T_NotEqual Expr
+               { $$ = new EqualityExpr($1, new Operator(@2,"!="), $3); }
+          |    Expr '<' Expr
+               { $$ = new RelationalExpr($1, new Operator(@2,"<"), $3); }
+          |    Expr '>' Expr
+               { $$ = new RelationalExpr($1, new Operator(@2,">"), $3); }
+          |    Expr T_LessEqual Expr
+               { $$ = new RelationalExpr($1, new Operator(@2,"<="), $3); }
+          |    Expr T_GreaterEqual Expr
+               { $$ = new RelationalExpr($1, new Operator(@2,">="), $3); }
+          |    Expr T_And Expr
+               { $$ = new LogicalExpr($1, new Operator(@2,"&&"), $3); }
+          |    Expr T_Or Expr
+               { $$ = new LogicalExpr($1, new Operator(@2,"||"), $3); }
+          |    '(' Expr ')'                   { $$ = $2; }
+          |    '-' Expr %prec T_UnaryMinus
+               { $$ = new ArithmeticExpr(new Operator(@1,"-"), $2); }
+          |    '!' Expr
+               { $$ = new LogicalExpr(new Operator(@1,"!"), $2); }
+          |    T_ReadInteger '(' ')'
+               { $$ = new ReadIntegerExpr(Join(@1,@3)); }
+          |    T_ReadLine '(' ')'
+               { $$ = new ReadLineExpr(Join(@1,@3)); }
+          |    T_New '(' T_Identifier ')'
+               { $$ = new NewExpr(Join(@1,@4),new NamedType(new Identifier(@3,$3))); }
+          |    T_NewArray '(' Expr ',' Type ')'
+               { $$ = new NewArrayExpr(Join(@1,@6),$3, $5); }
+          |    T_This                         { $$ = new This(@1); }
+          ;
+
+Constant  :    T_IntConstant                  { $$ = new IntConstant(@1,$1); }
+          |    T_BoolConstant                 { $$ = new BoolConstant(@1,$1); }
+          |    T_DoubleConstant
+               { $$ = new DoubleConstant(@1,$1); }
+          |    T_StringConstant
+               { $$ = new StringConstant(@1,$1); }
+          |    T_Null                         { $$ = new NullConstant(@1); }
+          ;
+
+Actuals   :    ExprList                       { $$ = $1; }
+          |    /* empty */                    { $$ = new SmallList<Expr*>; }
+          ;
+
+ExprList  :    ExprList ',' Expr              { ($$=$1)->Append($3); }
+          |    Expr
+               { ($$ = new SmallList<Expr*>)->Append($1); }
+          ;
+
+OptElse   :    T_Else Stmt                    { $$ = $2; }
+          |    /* empty */ %prec T_Lower_Than_Else { $$ = NULL; }
+          ;
 
 %%
 
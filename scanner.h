@@ -3,6 +3,10 @@
  * You should not need to modify this file. It declare a few constants,
  * types, variables,and functions that are used and/or exported by
  * the lex-generated scanner.
+ *
+ * The scanner is reentrant: all of its state lives in a yyscan_t
+ * handle owned by a Compilation (see compilation.h), and yylex is
+ * called by the parser with that handle rather than through globals.
  */
 
 #ifndef _H_scanner
@@ -12,14 +16,20 @@
 
 #define MaxIdentLen 31    // Maximum length for identifiers
 
-extern char *yytext;      // Text of lexeme just scanned
+#ifndef YY_TYPEDEF_YY_SCANNER_T  // flex guards its own copy the same way
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void *yyscan_t;   // Opaque scanner state from lex.yy.c
+#endif
 
+class Compilation;
 
-int yylex();              // Defined in the generated lex.yy.c file
-void yyrestart(FILE *fp); // ditto
 
+void InitScanner(Compilation *c, FILE *fp); // Defined in scanner.l user subroutines
+void InitScannerOnText(Compilation *c);     // ditto
+bool ScannerInComment(Compilation *c);      // ditto
+void FreeScanner(Compilation *c);           // ditto
+const char *GetLineNumbered(Compilation *c, int n);  // ditto
+void GetLineAndColumn(Compilation *c, unsigned int offset, int *line, int *column); // ditto
+int KeywordToken(const char *word, int len); // ditto, 0 for an identifier
 
-void InitScanner();                 // Defined in scanner.l user subroutines
-const char *GetLineNumbered(int n); // ditto
- 
 #endif
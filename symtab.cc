@@ -0,0 +1,59 @@
+/* File: symtab.cc
+ * ---------------
+ * Implementation of the SymbolTable class.
+ */
+
+#include "symtab.h"
+#include "utility.h"  // for Assert
+
+static thread_local SymbolTable *current = NULL;
+
+SymbolTable *SymbolTable::Current() {
+    return current;
+}
+
+void SymbolTable::SetCurrent(SymbolTable *symbols) {
+    current = symbols;
+}
+
+unsigned long SymbolTable::NumLookups() {
+    return Hashtable<Binding*>::NumLookups();
+}
+
+void SymbolTable::OpenScope() {
+    marks.push_back(log.size());
+}
+
+/* Function: CloseScope()
+ * ----------------------
+ * Undoes the log back to where the scope opened, newest binding first,
+ * so each removal takes the top of its name's stack. The log is a
+ * deque so that the bindings the table points to never move.
+ */
+void SymbolTable::CloseScope() {
+    Assert(!marks.empty());
+    size_t mark = marks.back();
+    marks.pop_back();
+    while (log.size() > mark) {
+        Binding &b = log.back();
+        names.Remove(b.name, &b);
+        log.pop_back();
+    }
+}
+
+void SymbolTable::Enter(const char *name, Decl *decl) {
+    Assert(!marks.empty());
+    Binding b = { name, decl, (int)marks.size() };
+    log.push_back(b);
+    names.Enter(name, &log.back(), false);
+}
+
+Decl *SymbolTable::Lookup(const char *name) {
+    Binding *b = names.Lookup(name);
+    return (b ? b->decl : NULL);
+}
+
+Decl *SymbolTable::LookupInScope(const char *name) {
+    Binding *b = names.Lookup(name);
+    return (b && b->scope == marks.size() ? b->decl : NULL);
+}
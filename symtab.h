@@ -0,0 +1,79 @@
+/* File: symtab.h
+ * --------------
+ * A SymbolTable holds the declarations visible at one point of a walk
+ * over the tree, for all the scopes open there at once, rather than
+ * each scope having a table of its own. Each name maps to the stack of
+ * its bindings, innermost on top, so finding what a name means is a
+ * single probe however deeply the scopes are nested. Every binding
+ * entered is also recorded in an undo log, and closing a scope takes
+ * off everything entered since it was opened, uncovering whatever those
+ * bindings shadowed. A scope that declares nothing need not be opened
+ * at all, so it costs nothing.
+ *
+ * CheckTree drives one through the tree, opening a scope at each node
+ * that declares names (see Node::openScope) and closing it once the
+ * node has been checked, and makes it current meanwhile so the checks
+ * can look names up in it. The global declarations stay in the
+ * Program.
+ *
+ * Sample usage:
+ *
+ *       symbols.OpenScope();
+ *       symbols.Enter(decl->getId()->getName(), decl);
+ *       ...
+ *       Decl *d = symbols.Lookup(name);
+ *       ...
+ *       symbols.CloseScope();
+ */
+
+#ifndef _H_symtab
+#define _H_symtab
+
+#include <deque>
+#include <vector>
+#include "hashtable.h"
+
+class Decl;
+
+class SymbolTable
+{
+  public:
+    SymbolTable() {}
+
+    void OpenScope();
+
+            // Removes the bindings entered since the matching OpenScope.
+    void CloseScope();
+
+            // Binds the interned name to decl in the innermost scope,
+            // shadowing any binding from the scopes outside it.
+    void Enter(const char *name, Decl *decl);
+
+            // Returns the innermost binding of the interned name, or
+            // NULL if it has none.
+    Decl *Lookup(const char *name);
+
+            // As Lookup, but only if the binding is in the innermost scope.
+    Decl *LookupInScope(const char *name);
+
+            // Returns the table the walk on this thread is using, or
+            // NULL if there is none.
+    static SymbolTable *Current();
+    static void SetCurrent(SymbolTable *symbols);
+
+            // Returns how many names all symbol tables have looked up
+            // (see Hashtable::NumLookups).
+    static unsigned long NumLookups();
+
+  private:
+    struct Binding {
+        const char *name;
+        Decl *decl;
+        int scope;          // how many scopes were open when entered
+    };
+    Hashtable<Binding*> names;  // innermost binding of each name
+    std::deque<Binding> log;    // every binding, in the order entered
+    std::vector<size_t> marks;  // log size when each open scope opened
+};
+
+#endif
@@ -0,0 +1,145 @@
+/* File: hashtable_test.cc
+ * -----------------------
+ * Checks Hashtable against a plain model of what it promises: a list of
+ * the (key, value) pairs entered, oldest first. Each round makes
+ * thousands of random Enter, Remove and Lookup calls on a table and the
+ * model alike, comparing Lookup and NumEntries after every call and the
+ * whole iteration order at the end of the round. The keys include short
+ * ones and long ones sharing a prefix, so the iterator's sort has to
+ * look past the first characters to order them.
+ *
+ * Built and run by "make check"; prints "ok" and exits 0, or reports the
+ * first difference and exits 1.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include "hashtable.h"
+
+struct Entry {
+    const char *key, *value;
+};
+
+static bool KeyLessThan(const Entry &a, const Entry &b)
+{
+    return strcmp(a.key, b.key) < 0;
+}
+
+/* Function: ModelLookup
+ * ---------------------
+ * The lastmost value entered under key, or NULL.
+ */
+static const char *ModelLookup(const std::vector<Entry> &model, const char *key)
+{
+    for (int i = model.size() - 1; i >= 0; i--)
+        if (model[i].key == key)
+            return model[i].value;
+    return NULL;
+}
+
+/* Function: MakeKeys
+ * ------------------
+ * Interns n distinct keys of assorted lengths: some a character or two,
+ * most sharing a long prefix, so that ties are common at every depth.
+ */
+static std::vector<const char *> MakeKeys(std::mt19937 &rng, int n)
+{
+    std::vector<const char *> keys;
+    while (keys.size() < n) {
+        std::string key;
+        switch (rng() % 4) {
+          case 0: key = std::string(1 + rng() % 2, 'a' + rng() % 3); break;
+          case 1: key = "k" + std::to_string(rng() % 1000); break;
+          case 2: key = "sharedprefix_" + std::to_string(rng()); break;
+          default: key = std::string(8 + rng() % 24, 'x') + (char)('a' + rng() % 26); break;
+        }
+        const char *interned = Intern(key.c_str());
+        if (std::find(keys.begin(), keys.end(), interned) == keys.end())
+            keys.push_back(interned);
+    }
+    return keys;
+}
+
+/* Function: RunRound
+ * ------------------
+ * Makes numOps random calls on a new table and the model, and returns
+ * false, having said why, as soon as they disagree.
+ */
+static bool RunRound(std::mt19937 &rng, int round, int numKeys, int numOps)
+{
+    Hashtable<const char *> table;
+    std::vector<Entry> model;
+    std::vector<const char *> keys = MakeKeys(rng, numKeys);
+    const char *values[] = { "v0", "v1", "v2", "v3", "v4" };
+
+    for (int op = 0; op < numOps; op++) {
+        const char *key = keys[rng() % keys.size()];
+        const char *value = values[rng() % 5];
+        switch (rng() % 4) {
+          case 0:   // overwrite: the lastmost value under key is replaced
+            for (int i = model.size() - 1; i >= 0; i--)
+                if (model[i].key == key) {
+                    model.erase(model.begin() + i);
+                    break;
+                }
+            table.Enter(key, value, true);
+            model.push_back((Entry){key, value});
+            break;
+          case 1:   // shadow: the earlier values stay
+            table.Enter(key, value, false);
+            model.push_back((Entry){key, value});
+            break;
+          case 2:   // the earliest matching pair goes
+            table.Remove(key, value);
+            for (size_t i = 0; i < model.size(); i++)
+                if (model[i].key == key && model[i].value == value) {
+                    model.erase(model.begin() + i);
+                    break;
+                }
+            break;
+          default:
+            break;
+        }
+        if (table.Lookup(key) != ModelLookup(model, key)) {
+            printf("round %d op %d: Lookup(\"%s\") differs\n", round, op, key);
+            return false;
+        }
+        if (table.NumEntries() != (int)model.size()) {
+            printf("round %d op %d: NumEntries %d, expected %d\n", round, op,
+                   table.NumEntries(), (int)model.size());
+            return false;
+        }
+    }
+
+    std::stable_sort(model.begin(), model.end(), KeyLessThan);
+    Iterator<const char *> iter = table.GetIterator();
+    for (size_t i = 0; i < model.size(); i++) {
+        const char *value = iter.GetNextValue();
+        if (value != model[i].value) {
+            printf("round %d: value %d of the iteration differs (key \"%s\")\n",
+                   round, (int)i, model[i].key);
+            return false;
+        }
+    }
+    if (iter.GetNextValue() != NULL) {
+        printf("round %d: the iteration gives more values than were entered\n", round);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    std::mt19937 rng(1);
+    for (int round = 0; round < 200; round++) {
+        int numKeys = 1 + rng() % (round < 100 ? 20 : 3000);
+        if (!RunRound(rng, round, numKeys, 5000))
+            return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
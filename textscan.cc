@@ -0,0 +1,186 @@
+/* File: textscan.cc
+ * -----------------
+ * Implementation of the text scanning routines. On x86 each routine
+ * comes in three versions: AVX2 (32 bytes per step), SSE2 (16 bytes
+ * per step) and plain C. The vector versions compare a whole block
+ * against the characters of interest, turn the result into a bit mask
+ * with movemask, and then either locate the first set bit or count the
+ * set bits with popcount. Whatever is left over at the end of the range
+ * is finished off by the plain version. Elsewhere only the plain
+ * versions are built.
+ */
+
+#include "textscan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define TEXTSCAN_X86
+#include <immintrin.h>
+#endif
+
+
+/* Plain versions
+ * --------------
+ * Also used for the tails of the vector versions.
+ */
+static const char *ScalarSpanSpaces(const char *p, const char *end)
+{
+  while (p < end && *p == ' ') p++;
+  return p;
+}
+
+static const char *ScalarFindEither(const char *p, const char *end, char a, char b)
+{
+  while (p < end && *p != a && *p != b) p++;
+  return p;
+}
+
+static int ScalarCountChar(const char *p, const char *end, char c)
+{
+  int count = 0;
+  for (; p < end; p++)
+    count += (*p == c);
+  return count;
+}
+
+
+#ifdef TEXTSCAN_X86
+
+/* SSE2 versions
+ * -------------
+ */
+__attribute__((target("sse2")))
+static const char *SSE2SpanSpaces(const char *p, const char *end)
+{
+  const __m128i spaces = _mm_set1_epi8(' ');
+  for (; end - p >= 16; p += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    unsigned int other = ~_mm_movemask_epi8(_mm_cmpeq_epi8(block, spaces)) & 0xFFFF;
+    if (other) return p + __builtin_ctz(other);
+  }
+  return ScalarSpanSpaces(p, end);
+}
+
+__attribute__((target("sse2")))
+static const char *SSE2FindEither(const char *p, const char *end, char a, char b)
+{
+  const __m128i va = _mm_set1_epi8(a), vb = _mm_set1_epi8(b);
+  for (; end - p >= 16; p += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    unsigned int found = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, va),
+                                                        _mm_cmpeq_epi8(block, vb)));
+    if (found) return p + __builtin_ctz(found);
+  }
+  return ScalarFindEither(p, end, a, b);
+}
+
+__attribute__((target("sse2,popcnt")))
+static int SSE2CountChar(const char *p, const char *end, char c)
+{
+  const __m128i vc = _mm_set1_epi8(c);
+  int count = 0;
+  for (; end - p >= 16; p += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(block, vc)));
+  }
+  return count + ScalarCountChar(p, end, c);
+}
+
+
+/* AVX2 versions
+ * -------------
+ */
+__attribute__((target("avx2")))
+static const char *AVX2SpanSpaces(const char *p, const char *end)
+{
+  const __m256i spaces = _mm256_set1_epi8(' ');
+  for (; end - p >= 32; p += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *)p);
+    unsigned int other = ~(unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, spaces));
+    if (other) return p + __builtin_ctz(other);
+  }
+  return SSE2SpanSpaces(p, end);
+}
+
+__attribute__((target("avx2")))
+static const char *AVX2FindEither(const char *p, const char *end, char a, char b)
+{
+  const __m256i va = _mm256_set1_epi8(a), vb = _mm256_set1_epi8(b);
+  for (; end - p >= 32; p += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *)p);
+    unsigned int found = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, va),
+                                                              _mm256_cmpeq_epi8(block, vb)));
+    if (found) return p + __builtin_ctz(found);
+  }
+  return SSE2FindEither(p, end, a, b);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int AVX2CountChar(const char *p, const char *end, char c)
+{
+  const __m256i vc = _mm256_set1_epi8(c);
+  int count = 0;
+  for (; end - p >= 32; p += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *)p);
+    count += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, vc)));
+  }
+  return count + SSE2CountChar(p, end, c);
+}
+
+#endif
+
+
+/* Dispatch
+ * --------
+ * The versions to use are chosen once, the first time any routine is
+ * called (the function-local static is initialized thread-safely).
+ */
+struct TextScanOps {
+  const char *version;
+  const char *(*spanSpaces)(const char *, const char *);
+  const char *(*findEither)(const char *, const char *, char, char);
+  int (*countChar)(const char *, const char *, char);
+};
+
+static TextScanOps ChooseOps()
+{
+#ifdef TEXTSCAN_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+    TextScanOps ops = {"avx2", AVX2SpanSpaces, AVX2FindEither, AVX2CountChar};
+    return ops;
+  }
+  if (__builtin_cpu_supports("sse2") && __builtin_cpu_supports("popcnt")) {
+    TextScanOps ops = {"sse2", SSE2SpanSpaces, SSE2FindEither, SSE2CountChar};
+    return ops;
+  }
+#endif
+  TextScanOps ops = {"scalar", ScalarSpanSpaces, ScalarFindEither, ScalarCountChar};
+  return ops;
+}
+
+static const TextScanOps &Ops()
+{
+  static const TextScanOps ops = ChooseOps();
+  return ops;
+}
+
+
+const char *SpanSpaces(const char *p, const char *end)
+{
+  return Ops().spanSpaces(p, end);
+}
+
+const char *FindEither(const char *p, const char *end, char a, char b)
+{
+  return Ops().findEither(p, end, a, b);
+}
+
+int CountChar(const char *p, const char *end, char c)
+{
+  return Ops().countChar(p, end, c);
+}
+
+const char *TextScanVersion()
+{
+  return Ops().version;
+}
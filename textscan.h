@@ -0,0 +1,49 @@
+/* File: textscan.h
+ * ----------------
+ * Routines the scanner uses to run over long stretches of text in which
+ * it is only looking for one or two particular characters: runs of
+ * indentation, and the bodies of comments and string constants. flex's
+ * DFA takes these one character at a time; these look at 16 or 32 at
+ * once. Each routine has an AVX2, an SSE2 and a plain version, and the
+ * best one the processor supports is picked on first use.
+ *
+ * All of them work on the half-open range [p, end) and never read
+ * outside it.
+ */
+
+#ifndef _H_textscan
+#define _H_textscan
+
+
+/* Function: SpanSpaces()
+ * ----------------------
+ * Returns a pointer to the first character in the range that is not a
+ * space (' '), or end if they all are.
+ */
+const char *SpanSpaces(const char *p, const char *end);
+
+
+/* Function: FindEither()
+ * ----------------------
+ * Returns a pointer to the first occurrence of a or b in the range, or
+ * end if neither occurs. Pass the same character twice to look for one.
+ */
+const char *FindEither(const char *p, const char *end, char a, char b);
+
+
+/* Function: CountChar()
+ * ---------------------
+ * Returns the number of occurrences of c in the range. Used to count
+ * the lines of the source before indexing where they start.
+ */
+int CountChar(const char *p, const char *end, char c);
+
+
+/* Function: TextScanVersion()
+ * ---------------------------
+ * Returns "avx2", "sse2" or "scalar" according to which versions of the
+ * routines above are in use.
+ */
+const char *TextScanVersion();
+
+#endif
@@ -0,0 +1,211 @@
+/* File: tokens.cc
+ * ---------------
+ * Implementation of the token buffer and token ring.
+ */
+
+#include "tokens.h"
+#include <thread>    // for yield
+
+
+TokenBuffer::TokenBuffer() : cursor(0), nextMessage(0), haveEndLoc(false) {}
+
+TokenBuffer::TokenBuffer(const TokenBuffer &whole, int begin, int end)
+  : cursor(0), nextMessage(0), haveEndLoc(false) {
+    int m = 0, numMessages = whole.messages.size();
+    while (m < numMessages && whole.messageTokens[m] < begin)
+        m++;
+    MessageList held;
+    YYSTYPE value = YYSTYPE();
+    for (int i = begin; i < end; i++) {
+        for (; m < numMessages && whole.messageTokens[m] <= i; m++)
+            held.push_back(whole.messages[m]);
+        whole.ValueAt(i, &value);
+        Append(whole.kinds[i], value, whole.locations[i], held);
+    }
+    if (end < whole.kinds.size())
+        Append(0, value, whole.locations[end], held);
+}
+
+void TokenBuffer::Append(int kind, const YYSTYPE &value, const yyltype &loc,
+                         MessageList &held) {
+    for (int i = 0; i < held.size(); i++) {
+        messages.push_back(held[i]);
+        messageTokens.push_back(kinds.size());
+    }
+    held.clear();
+
+    unsigned int payload = 0;
+    switch (kind) {
+      case T_Identifier:
+        payload = identifiers.size();
+        identifiers.push_back(value.identifier);
+        break;
+      case T_IntConstant:
+        payload = integers.size();
+        integers.push_back(value.integerConstant);
+        break;
+      case T_DoubleConstant:
+        payload = doubles.size();
+        doubles.push_back(value.doubleConstant);
+        break;
+      case T_StringConstant:
+        payload = strings.size();
+        strings.push_back(value.stringConstant);
+        break;
+      case T_BoolConstant:
+        payload = value.boolConstant;
+        break;
+    }
+    Assert(kind >= 0 && kind <= 0xFFFF);
+    kinds.push_back(kind);
+    locations.push_back(loc);
+    payloads.push_back(payload);
+}
+
+/* Function: Splice()
+ * -------------------
+ * The payload indexes of other's tokens are offset by the sizes of our
+ * side tables, which other's are appended to.
+ *
+ * The end-of-input token carries the location of the last thing the
+ * scanner matched. A piece that starts inside a comment carried over
+ * from the one before is scanned with a comment opener put in front of
+ * it, just before start (see the piece constructor of Compilation), and
+ * if nothing follows that comment, this made-up location is what the
+ * piece ends with. The real one is where the comment opened, in an
+ * earlier piece, so we keep the last real end location seen and
+ * substitute it.
+ */
+void TokenBuffer::Splice(const TokenBuffer &other, SourceLoc start, bool lastPiece,
+                         bool inComment) {
+    int count = other.kinds.size();
+    Assert(count > 0 && other.kinds[count-1] == 0);
+    yyltype otherEnd = other.locations[count-1];
+    if (otherEnd.first >= start) {
+        endLoc = otherEnd;
+        haveEndLoc = true;
+    }
+    int numMessages = other.messages.size();
+    if (!lastPiece) {
+        count--;
+        if (inComment) numMessages--;
+    }
+
+    int base = kinds.size();
+    for (int i = 0; i < numMessages; i++) {
+        messages.push_back(other.messages[i]);
+        messageTokens.push_back(base + other.messageTokens[i]);
+    }
+
+    unsigned int identBase = identifiers.size(), intBase = integers.size();
+    unsigned int doubleBase = doubles.size(), stringBase = strings.size();
+    identifiers.insert(identifiers.end(), other.identifiers.begin(), other.identifiers.end());
+    integers.insert(integers.end(), other.integers.begin(), other.integers.end());
+    doubles.insert(doubles.end(), other.doubles.begin(), other.doubles.end());
+    strings.insert(strings.end(), other.strings.begin(), other.strings.end());
+
+    kinds.insert(kinds.end(), other.kinds.begin(), other.kinds.begin() + count);
+    locations.insert(locations.end(), other.locations.begin(), other.locations.begin() + count);
+    if (lastPiece && otherEnd.first < start && haveEndLoc)
+        locations.back() = endLoc;
+    for (int i = 0; i < count; i++) {
+        unsigned int payload = other.payloads[i];
+        switch (other.kinds[i]) {
+          case T_Identifier:     payload += identBase; break;
+          case T_IntConstant:    payload += intBase; break;
+          case T_DoubleConstant: payload += doubleBase; break;
+          case T_StringConstant: payload += stringBase; break;
+        }
+        payloads.push_back(payload);
+    }
+}
+
+int TokenBuffer::Next(YYSTYPE *value, yyltype *loc) {
+    while (nextMessage < messages.size() && messageTokens[nextMessage] <= cursor)
+        ReportError::Replay(messages[nextMessage++]);
+    if (cursor == kinds.size())
+        return 0;
+
+    int kind = kinds[cursor];
+    ValueAt(cursor, value);
+    *loc = locations[cursor];
+    cursor++;
+    return kind;
+}
+
+void TokenBuffer::ValueAt(int i, YYSTYPE *value) const {
+    unsigned int payload = payloads[i];
+    switch (kinds[i]) {
+      case T_Identifier:     value->identifier = identifiers[payload]; break;
+      case T_IntConstant:    value->integerConstant = integers[payload]; break;
+      case T_DoubleConstant: value->doubleConstant = doubles[payload]; break;
+      case T_StringConstant: value->stringConstant = strings[payload]; break;
+      case T_BoolConstant:   value->boolConstant = payload; break;
+    }
+}
+
+void TokenBuffer::DropTaken() {
+    Assert(cursor == kinds.size());
+    messages.erase(messages.begin(), messages.begin() + nextMessage);
+    messageTokens.erase(messageTokens.begin(), messageTokens.begin() + nextMessage);
+    for (int i = 0; i < messageTokens.size(); i++)
+        messageTokens[i] -= cursor;
+    kinds.clear();
+    locations.clear();
+    payloads.clear();
+    identifiers.clear();
+    integers.clear();
+    doubles.clear();
+    strings.clear();
+    cursor = nextMessage = 0;
+}
+
+
+TokenRing::TokenRing() : head(0), tail(0), closed(false) {}
+
+TokenRing::~TokenRing() {
+    unsigned int t = tail.load(std::memory_order_acquire);
+    for (unsigned int h = head.load(std::memory_order_relaxed); h != t; h++)
+        delete slots[h & (Capacity - 1)].messages;
+}
+
+bool TokenRing::Put(int kind, const YYSTYPE &value, const yyltype &loc,
+                    MessageList &held) {
+    unsigned int t = tail.load(std::memory_order_relaxed);
+    while (t - head.load(std::memory_order_acquire) == Capacity) {
+        if (closed.load(std::memory_order_acquire)) return false;
+        std::this_thread::yield();
+    }
+    Slot &slot = slots[t & (Capacity - 1)];
+    slot.kind = kind;
+    slot.value = value;
+    slot.loc = loc;
+    slot.messages = NULL;
+    if (!held.empty()) {
+        slot.messages = new MessageList;
+        slot.messages->swap(held);
+    }
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+int TokenRing::Take(YYSTYPE *value, yyltype *loc) {
+    unsigned int h = head.load(std::memory_order_relaxed);
+    while (tail.load(std::memory_order_acquire) == h)
+        std::this_thread::yield();
+    Slot &slot = slots[h & (Capacity - 1)];
+    if (slot.messages) {
+        for (int i = 0; i < slot.messages->size(); i++)
+            ReportError::Replay((*slot.messages)[i]);
+        delete slot.messages;
+    }
+    int kind = slot.kind;
+    *value = slot.value;
+    *loc = slot.loc;
+    head.store(h + 1, std::memory_order_release);
+    return kind;
+}
+
+void TokenRing::Close() {
+    closed.store(true, std::memory_order_release);
+}
@@ -0,0 +1,135 @@
+/* File: tokens.h
+ * --------------
+ * Containers for tokens scanned ahead of the parser, so that scanning
+ * and parsing can be run (and timed) as separate phases.
+ *
+ * A TokenBuffer holds every token of a file as a structure of arrays:
+ * one array of token codes, one of locations and one of payload
+ * indexes. The semantic values live in side tables by kind (interned
+ * identifiers, integers, doubles, strings), so a token costs 14 bytes
+ * plus its payload rather than a full YYSTYPE and yyltype.
+ *
+ * A TokenRing is a bounded single-producer, single-consumer queue that
+ * lets the scanner run on its own thread a little way ahead of the
+ * parser.
+ *
+ * In both cases messages the scanner reports are deferred (see
+ * ReportError::DeferOutput) and stored with the token they came before,
+ * and they are printed when the parser takes that token. Diagnostics
+ * therefore come out in the same order as when the parser calls the
+ * scanner for each token itself.
+ */
+
+#ifndef _H_tokens
+#define _H_tokens
+
+#include <vector>
+#include <atomic>
+#include <stdint.h>
+#include "parser.h"   // for YYSTYPE and the token codes
+#include "errors.h"   // for ReportError::Message
+
+typedef std::vector<ReportError::Message> MessageList;
+
+
+class TokenBuffer
+{
+  public:
+    TokenBuffer();
+
+            // Makes a buffer of the tokens of whole from begin up to
+            // end, with the messages stored with them, ending with an
+            // end-of-input token at the location of token end (or with
+            // whole's own, if end is past it).
+    TokenBuffer(const TokenBuffer &whole, int begin, int end);
+
+            // Adds the next token, preceded by the messages in held. The
+            // messages are moved out, leaving held empty.
+    void Append(int kind, const YYSTYPE &value, const yyltype &loc,
+                MessageList &held);
+
+            // Adds all the tokens of other, which was filled by
+            // scanning the piece of the source following the tokens
+            // already here, starting at location start. Unless other
+            // is the last piece, its end-of-input token is dropped, the
+            // messages stored with it go with the next token instead,
+            // and if the piece was cut off inside a comment, the last
+            // of them (reporting the comment as unterminated) is
+            // dropped too.
+    void Splice(const TokenBuffer &other, SourceLoc start, bool lastPiece,
+                bool inComment);
+
+    int NumTokens() const { return kinds.size(); }
+    int NumLeft() const { return kinds.size() - cursor; }
+    int KindAt(int i) const { return kinds[i]; }
+
+            // Returns the code of the next token and fills in its value
+            // and location, first printing any messages stored with it.
+            // Returns 0 (end of input) once all tokens have been taken.
+    int Next(YYSTYPE *value, yyltype *loc);
+
+            // Once every token has been taken, frees them, so that a
+            // buffer being refilled a piece at a time stays small.
+            // Messages still waiting for the next token are kept.
+    void DropTaken();
+
+  private:
+    std::vector<unsigned short> kinds;
+    std::vector<yyltype> locations;
+    std::vector<unsigned int> payloads;
+
+    std::vector<const char *> identifiers;  // interned
+    std::vector<int> integers;
+    std::vector<double> doubles;
+    std::vector<const char *> strings;      // interned
+
+    MessageList messages;
+    std::vector<int> messageTokens;         // token each message precedes
+
+    int cursor, nextMessage;
+
+    void ValueAt(int i, YYSTYPE *value) const;
+
+    bool haveEndLoc;        // location of the last real match in the
+    yyltype endLoc;         // pieces spliced so far, see Splice
+};
+
+
+class TokenRing
+{
+  public:
+    TokenRing();
+
+            // Frees the messages of any tokens never taken, as when the
+            // parser stops early. The producer must have finished.
+    ~TokenRing();
+
+            // Producer side: adds the next token, preceded by the held
+            // messages, waiting while the ring is full. Returns false
+            // without adding it if the consumer has closed the ring.
+    bool Put(int kind, const YYSTYPE &value, const yyltype &loc,
+             MessageList &held);
+
+            // Consumer side: as TokenBuffer::Next, waiting while the
+            // ring is empty.
+    int Take(YYSTYPE *value, yyltype *loc);
+
+            // Consumer side: tells the producer no more tokens will be
+            // taken, so it should stop rather than wait for room.
+    void Close();
+
+  private:
+    struct Slot {
+        int kind;
+        YYSTYPE value;
+        yyltype loc;
+        MessageList *messages;  // NULL when there are none
+    };
+    static const unsigned int Capacity = 1024;  // a power of two
+
+    Slot slots[Capacity];
+    std::atomic<unsigned int> head, tail;       // next to take, next to put
+    std::atomic<bool> closed;
+};
+
+#endif
@@ -10,6 +10,7 @@
 #include <string.h>
 
 static List<const char*> debugKeys;
+static List<const char*> optionNames, optionValues;
 static const int BufferSize = 2048;
 
 void Failure(const char *format, ...)
@@ -66,17 +67,33 @@ void PrintDebug(const char *key, const char *format, ...)
 }
 
 
+const char *GetOption(const char *name)
+{
+  for (int i = 0; i < optionNames.NumElements(); i++)
+    if (!strcmp(optionNames.Nth(i), name)) return optionValues.Nth(i);
+  return NULL;
+}
+
+
 void ParseCommandLine(int argc, char *argv[])
 {
-  if (argc == 1)
+  int i = 1;
+  char *eq;
+
+  for (; i < argc && argv[i][0] == '-' && (eq = strchr(argv[i], '=')) != NULL; i++) {
+    *eq = '\0';
+    optionNames.Append(argv[i] + 1);
+    optionValues.Append(eq + 1);
+  }
+  if (i == argc)
     return;
   
-  if (strcmp(argv[1], "-d") != 0) { // first arg is not -d
-    printf("Usage:   -d <debug-key-1> <debug-key-2> ... \n");
+  if (strcmp(argv[i], "-d") != 0) { // next arg is not -d
+    printf("Usage:   [-<option>=<value> ...] [-d <debug-key-1> <debug-key-2> ...]\n");
     exit(2);
   }
 
-  for (int i = 2; i < argc; i++)
+  for (i++; i < argc; i++)
     SetDebugForKey(argv[i], true);
 }
 
@@ -72,11 +72,22 @@ bool IsDebugOn(const char *key);
 
 
 
+/* Function: GetOption()
+ * Usage: const char *mode = GetOption("lex");
+ * -------------------------------------------
+ * Returns the value given for an option on the command line as
+ * -name=value, or NULL if the option was not given.
+ */
+const char *GetOption(const char *name);
+
+
+
 /* Function: ParseCommandLine
  * --------------------------
- * Turn on the debugging flags from the command line.  Verifies that
- * first argument is -d, and then interpret all the arguments that follow
- * as being flags to turn on.
+ * Turn on the debugging flags from the command line.  Any leading
+ * arguments of the form -name=value are recorded as options for
+ * GetOption. After those, verifies that the next argument is -d, and
+ * then interpret all the arguments that follow as being flags to turn on.
  */
 void ParseCommandLine(int argc, char *argv[]);
      